@@ -0,0 +1,218 @@
+/**
+ * \file    alg_kernels.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Scalar kernels and selection of the best kernels for the algorithms module.
+ * \date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "alg_kernels.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform/cpu_dispatch.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief States of the selection of the kernels.
+ */
+enum
+{
+  KERNELS_UNSELECTED = 0, /**< Nobody has started the selection */
+  KERNELS_SELECTING,      /**< One thread fills the table */
+  KERNELS_SELECTED,       /**< The table is filled and published */
+};
+//_____ M A C R O S ___________________________________________________________
+/** Defines the scalar sum kernel for the type `T` which is accumulated in the field `F` of `alg_acc_t` */
+#define SCALAR_SUM(NAME, T, F)                                  \
+  static void NAME(const void *data, size_t count, alg_acc_t *acc) \
+  {                                                             \
+    const T *element = (const T *)data;                         \
+    for (size_t i = 0; i < count; i++)                          \
+    {                                                           \
+      acc->F += element[i];                                     \
+    }                                                           \
+  }
+
+/** Defines the scalar min/max kernel for the type `T` */
+#define SCALAR_MINMAX(NAME, T)                                                   \
+  static void NAME(const void *data, size_t count, void *min, void *max)         \
+  {                                                                              \
+    const T *element = (const T *)data;                                          \
+    T lo = *(T *)min;                                                            \
+    T hi = *(T *)max;                                                            \
+    for (size_t i = 0; i < count; i++)                                           \
+    {                                                                            \
+      lo = (element[i] < lo) ? element[i] : lo;                                  \
+      hi = (element[i] > hi) ? element[i] : hi;                                  \
+    }                                                                            \
+    *(T *)min = lo;                                                              \
+    *(T *)max = hi;                                                              \
+  }
+
+/** Defines the scalar find kernel for elements of the unsigned integer type `T` */
+#define SCALAR_FIND(NAME, T)                                               \
+  static size_t NAME(const void *data, size_t count, const void *value)    \
+  {                                                                        \
+    const T *element = (const T *)data;                                    \
+    T v;                                                                   \
+    memcpy(&v, value, sizeof(T));                                          \
+    for (size_t i = 0; i < count; i++)                                     \
+    {                                                                      \
+      if (element[i] == v)                                                 \
+      {                                                                    \
+        return i;                                                          \
+      }                                                                    \
+    }                                                                      \
+    return count;                                                          \
+  }
+//_____ V A R I A B L E S _____________________________________________________
+const size_t alg_type_size[ALG_TYPE_COUNT] = {
+  [ALG_TYPE_I8] = sizeof(int8_t),
+  [ALG_TYPE_U8] = sizeof(uint8_t),
+  [ALG_TYPE_I16] = sizeof(int16_t),
+  [ALG_TYPE_U16] = sizeof(uint16_t),
+  [ALG_TYPE_I32] = sizeof(int32_t),
+  [ALG_TYPE_U32] = sizeof(uint32_t),
+  [ALG_TYPE_I64] = sizeof(int64_t),
+  [ALG_TYPE_U64] = sizeof(uint64_t),
+  [ALG_TYPE_FLOAT] = sizeof(float),
+  [ALG_TYPE_DOUBLE] = sizeof(double),
+};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+SCALAR_SUM(sum_i8, int8_t, i)
+SCALAR_SUM(sum_u8, uint8_t, u)
+SCALAR_SUM(sum_i16, int16_t, i)
+SCALAR_SUM(sum_u16, uint16_t, u)
+SCALAR_SUM(sum_i32, int32_t, i)
+SCALAR_SUM(sum_u32, uint32_t, u)
+SCALAR_SUM(sum_u64, uint64_t, u)
+SCALAR_SUM(sum_float, float, f)
+SCALAR_SUM(sum_double, double, f)
+
+/**
+ * \brief Sum kernel for `int64_t`: the addition is done in unsigned type to wrap around on overflow.
+ */
+static void sum_i64(const void *data, size_t count, alg_acc_t *acc)
+{
+  const int64_t *element = (const int64_t *)data;
+  uint64_t sum = (uint64_t)acc->i;
+  for (size_t i = 0; i < count; i++)
+  {
+    sum += (uint64_t)element[i];
+  }
+  acc->i = (int64_t)sum;
+}
+
+SCALAR_MINMAX(minmax_i8, int8_t)
+SCALAR_MINMAX(minmax_u8, uint8_t)
+SCALAR_MINMAX(minmax_i16, int16_t)
+SCALAR_MINMAX(minmax_u16, uint16_t)
+SCALAR_MINMAX(minmax_i32, int32_t)
+SCALAR_MINMAX(minmax_u32, uint32_t)
+SCALAR_MINMAX(minmax_i64, int64_t)
+SCALAR_MINMAX(minmax_u64, uint64_t)
+SCALAR_MINMAX(minmax_float, float)
+SCALAR_MINMAX(minmax_double, double)
+
+SCALAR_FIND(find_8, uint8_t)
+SCALAR_FIND(find_16, uint16_t)
+SCALAR_FIND(find_32, uint32_t)
+SCALAR_FIND(find_64, uint64_t)
+
+/**
+ * \brief Fills the table by the best kernels supported by the CPU.
+ */
+static void select_kernels(alg_kernels_t *kernels)
+{
+  alg_kernels_scalar(kernels);
+
+#if ALG_SIMD_X86
+  if (cpu_has(CPU_FEATURE_SSE2))
+  {
+    alg_kernels_sse2(kernels);
+  }
+
+  if (cpu_has(CPU_FEATURE_AVX2))
+  {
+    alg_kernels_avx2(kernels);
+  }
+
+  if (cpu_has(CPU_FEATURE_AVX512F))
+  {
+    alg_kernels_avx512(kernels);
+  }
+#endif
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Fills the table by the scalar kernels.
+ *
+ * Detailed description see in alg_kernels.h
+ */
+void alg_kernels_scalar(alg_kernels_t *kernels)
+{
+  kernels->sum[ALG_TYPE_I8] = sum_i8;
+  kernels->sum[ALG_TYPE_U8] = sum_u8;
+  kernels->sum[ALG_TYPE_I16] = sum_i16;
+  kernels->sum[ALG_TYPE_U16] = sum_u16;
+  kernels->sum[ALG_TYPE_I32] = sum_i32;
+  kernels->sum[ALG_TYPE_U32] = sum_u32;
+  kernels->sum[ALG_TYPE_I64] = sum_i64;
+  kernels->sum[ALG_TYPE_U64] = sum_u64;
+  kernels->sum[ALG_TYPE_FLOAT] = sum_float;
+  kernels->sum[ALG_TYPE_DOUBLE] = sum_double;
+
+  kernels->minmax[ALG_TYPE_I8] = minmax_i8;
+  kernels->minmax[ALG_TYPE_U8] = minmax_u8;
+  kernels->minmax[ALG_TYPE_I16] = minmax_i16;
+  kernels->minmax[ALG_TYPE_U16] = minmax_u16;
+  kernels->minmax[ALG_TYPE_I32] = minmax_i32;
+  kernels->minmax[ALG_TYPE_U32] = minmax_u32;
+  kernels->minmax[ALG_TYPE_I64] = minmax_i64;
+  kernels->minmax[ALG_TYPE_U64] = minmax_u64;
+  kernels->minmax[ALG_TYPE_FLOAT] = minmax_float;
+  kernels->minmax[ALG_TYPE_DOUBLE] = minmax_double;
+
+  kernels->find[0] = find_8;
+  kernels->find[1] = find_16;
+  kernels->find[2] = find_32;
+  kernels->find[3] = find_64;
+}
+
+/**
+ * \brief Returns the table of the best kernels.
+ *
+ * Detailed description see in alg_kernels.h
+ */
+const alg_kernels_t *alg_kernels(void)
+{
+  static alg_kernels_t kernels;
+  static atomic_int state = KERNELS_UNSELECTED;
+
+  if (KERNELS_SELECTED == atomic_load_explicit(&state, memory_order_acquire))
+  {
+    return &kernels;
+  }
+
+  // The first caller fills the table, the concurrent ones wait until it is published
+  int expected = KERNELS_UNSELECTED;
+  if (atomic_compare_exchange_strong_explicit(&state, &expected, KERNELS_SELECTING, memory_order_acquire,
+                                              memory_order_acquire))
+  {
+    select_kernels(&kernels);
+    atomic_store_explicit(&state, KERNELS_SELECTED, memory_order_release);
+  }
+  else
+  {
+    while (KERNELS_SELECTED != atomic_load_explicit(&state, memory_order_acquire))
+    {
+    }
+  }
+
+  return &kernels;
+}
@@ -0,0 +1,103 @@
+/**
+ * \file    alg_kernels.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Kernels which process contiguous spans of elements for the algorithms module. Private header.
+ * \date    2026-10-18
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "algorithms.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 to build the library without SIMD kernels */
+#ifndef ALG_USE_SIMD
+  #define ALG_USE_SIMD 1
+#endif
+
+#if ALG_USE_SIMD && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define ALG_SIMD_X86 1
+#else
+  #define ALG_SIMD_X86 0
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Accumulator of the sum.
+ */
+typedef union
+{
+  int64_t i;  /**< Sum of signed integer elements */
+  uint64_t u; /**< Sum of unsigned integer elements */
+  double f;   /**< Sum of floating point elements */
+} alg_acc_t;
+
+/**
+ * \brief Storage for the single element of any supported type.
+ */
+typedef union
+{
+  int8_t i8;
+  uint8_t u8;
+  int16_t i16;
+  uint16_t u16;
+  int32_t i32;
+  uint32_t u32;
+  int64_t i64;
+  uint64_t u64;
+  float f;
+  double d;
+} alg_value_t;
+
+/** Adds `count` elements to the accumulator */
+typedef void (*alg_sum_fn_t)(const void *data, size_t count, alg_acc_t *acc);
+
+/** Updates `min` and `max` (which hold valid elements on input) by `count` elements */
+typedef void (*alg_minmax_fn_t)(const void *data, size_t count, void *min, void *max);
+
+/** Returns index of the first element equal to `value` or `count` if there is no such element */
+typedef size_t (*alg_find_fn_t)(const void *data, size_t count, const void *value);
+
+/**
+ * \brief Table of the kernels which are used by the algorithms.
+ */
+typedef struct
+{
+  alg_sum_fn_t sum[ALG_TYPE_COUNT];
+  alg_minmax_fn_t minmax[ALG_TYPE_COUNT];
+  alg_find_fn_t find[4]; /**< Kernels for elements of 1, 2, 4 and 8 bytes */
+} alg_kernels_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+/** Size in bytes of the element of every supported type */
+extern const size_t alg_type_size[ALG_TYPE_COUNT];
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Returns the table of the best kernels supported by the CPU.
+ */
+const alg_kernels_t *alg_kernels(void);
+
+/**
+ * \brief Fills the table by the scalar kernels which are supported by any CPU.
+ */
+void alg_kernels_scalar(alg_kernels_t *kernels);
+
+#if ALG_SIMD_X86
+/**
+ * \brief Replaces the kernels in the table by their SSE2 versions.
+ */
+void alg_kernels_sse2(alg_kernels_t *kernels);
+
+/**
+ * \brief Replaces the kernels in the table by their AVX2 versions.
+ */
+void alg_kernels_avx2(alg_kernels_t *kernels);
+
+/**
+ * \brief Replaces the kernels in the table by their AVX-512 versions.
+ */
+void alg_kernels_avx512(alg_kernels_t *kernels);
+#endif
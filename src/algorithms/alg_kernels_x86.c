@@ -0,0 +1,836 @@
+/**
+ * \file    alg_kernels_x86.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   SSE2, AVX2 and AVX-512 kernels for the algorithms module.
+ * \date    2026-10-18
+ *
+ * Every kernel is compiled for its instruction set by `target` attribute, so the file does not need any
+ * special compiler flags and the kernels are called only if the CPU supports them (see `alg_kernels`).
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "alg_kernels.h"
+
+#if ALG_SIMD_X86
+
+  #include <immintrin.h>
+  #include <stdbool.h>
+  #include <stddef.h>
+  #include <stdint.h>
+  #include <string.h>
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+  #define SSE2   __attribute__((target("sse2")))
+  #define AVX2   __attribute__((target("avx2")))
+  #define AVX512 __attribute__((target("avx512f")))
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Returns the index of the first set bit of the non zero mask.
+ */
+static inline size_t first_bit(uint32_t mask)
+{
+  return (size_t)__builtin_ctz(mask);
+}
+
+//----- SSE2 ------------------------------------------------------------------
+
+SSE2 static void sse2_sum_i32(const void *data, size_t count, alg_acc_t *acc)
+{
+  const int32_t *element = (const int32_t *)data;
+  __m128i sum = _mm_setzero_si128();
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i x = _mm_loadu_si128((const __m128i *)(element + i));
+    __m128i sign = _mm_srai_epi32(x, 31);
+    sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(x, sign));
+    sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(x, sign));
+  }
+
+  int64_t lanes[2];
+  _mm_storeu_si128((__m128i *)lanes, sum);
+  uint64_t total = (uint64_t)acc->i + (uint64_t)lanes[0] + (uint64_t)lanes[1];
+
+  for (; i < count; i++)
+  {
+    total += (uint64_t)(int64_t)element[i];
+  }
+
+  acc->i = (int64_t)total;
+}
+
+SSE2 static void sse2_sum_u32(const void *data, size_t count, alg_acc_t *acc)
+{
+  const uint32_t *element = (const uint32_t *)data;
+  const __m128i zero = _mm_setzero_si128();
+  __m128i sum = _mm_setzero_si128();
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i x = _mm_loadu_si128((const __m128i *)(element + i));
+    sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(x, zero));
+    sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(x, zero));
+  }
+
+  uint64_t lanes[2];
+  _mm_storeu_si128((__m128i *)lanes, sum);
+  acc->u += lanes[0] + lanes[1];
+
+  for (; i < count; i++)
+  {
+    acc->u += element[i];
+  }
+}
+
+SSE2 static void sse2_sum_float(const void *data, size_t count, alg_acc_t *acc)
+{
+  const float *element = (const float *)data;
+  __m128d sum = _mm_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 x = _mm_loadu_ps(element + i);
+    sum = _mm_add_pd(sum, _mm_cvtps_pd(x));
+    sum = _mm_add_pd(sum, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+  }
+
+  double lanes[2];
+  _mm_storeu_pd(lanes, sum);
+  acc->f += lanes[0] + lanes[1];
+
+  for (; i < count; i++)
+  {
+    acc->f += element[i];
+  }
+}
+
+SSE2 static void sse2_sum_double(const void *data, size_t count, alg_acc_t *acc)
+{
+  const double *element = (const double *)data;
+  __m128d sum0 = _mm_setzero_pd();
+  __m128d sum1 = _mm_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4)
+  {
+    sum0 = _mm_add_pd(sum0, _mm_loadu_pd(element + i));
+    sum1 = _mm_add_pd(sum1, _mm_loadu_pd(element + i + 2));
+  }
+
+  double lanes[2];
+  _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+  acc->f += lanes[0] + lanes[1];
+
+  for (; i < count; i++)
+  {
+    acc->f += element[i];
+  }
+}
+
+/**
+ * \brief Min/max of signed 32 bit integers. `bias` is XORed with elements to compare unsigned ones as signed.
+ */
+SSE2 static inline void sse2_minmax_32(const uint32_t *element, size_t count, uint32_t bias, uint32_t *min, uint32_t *max)
+{
+  const __m128i b = _mm_set1_epi32((int32_t)bias);
+  __m128i lo = _mm_set1_epi32((int32_t)(*min ^ bias));
+  __m128i hi = _mm_set1_epi32((int32_t)(*max ^ bias));
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(element + i)), b);
+    __m128i lt = _mm_cmplt_epi32(x, lo);
+    __m128i gt = _mm_cmpgt_epi32(x, hi);
+    lo = _mm_or_si128(_mm_and_si128(lt, x), _mm_andnot_si128(lt, lo));
+    hi = _mm_or_si128(_mm_and_si128(gt, x), _mm_andnot_si128(gt, hi));
+  }
+
+  int32_t lanes_lo[4];
+  int32_t lanes_hi[4];
+  _mm_storeu_si128((__m128i *)lanes_lo, lo);
+  _mm_storeu_si128((__m128i *)lanes_hi, hi);
+
+  int32_t l = lanes_lo[0];
+  int32_t h = lanes_hi[0];
+  for (size_t j = 1; j < 4; j++)
+  {
+    l = (lanes_lo[j] < l) ? lanes_lo[j] : l;
+    h = (lanes_hi[j] > h) ? lanes_hi[j] : h;
+  }
+
+  for (; i < count; i++)
+  {
+    int32_t x = (int32_t)(element[i] ^ bias);
+    l = (x < l) ? x : l;
+    h = (x > h) ? x : h;
+  }
+
+  *min = (uint32_t)l ^ bias;
+  *max = (uint32_t)h ^ bias;
+}
+
+SSE2 static void sse2_minmax_i32(const void *data, size_t count, void *min, void *max)
+{
+  sse2_minmax_32((const uint32_t *)data, count, 0, (uint32_t *)min, (uint32_t *)max);
+}
+
+SSE2 static void sse2_minmax_u32(const void *data, size_t count, void *min, void *max)
+{
+  sse2_minmax_32((const uint32_t *)data, count, 0x80000000u, (uint32_t *)min, (uint32_t *)max);
+}
+
+SSE2 static void sse2_minmax_float(const void *data, size_t count, void *min, void *max)
+{
+  const float *element = (const float *)data;
+  __m128 lo = _mm_set1_ps(*(float *)min);
+  __m128 hi = _mm_set1_ps(*(float *)max);
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 x = _mm_loadu_ps(element + i);
+    lo = _mm_min_ps(lo, x);
+    hi = _mm_max_ps(hi, x);
+  }
+
+  float lanes_lo[4];
+  float lanes_hi[4];
+  _mm_storeu_ps(lanes_lo, lo);
+  _mm_storeu_ps(lanes_hi, hi);
+
+  float l = lanes_lo[0];
+  float h = lanes_hi[0];
+  for (size_t j = 1; j < 4; j++)
+  {
+    l = (lanes_lo[j] < l) ? lanes_lo[j] : l;
+    h = (lanes_hi[j] > h) ? lanes_hi[j] : h;
+  }
+
+  for (; i < count; i++)
+  {
+    l = (element[i] < l) ? element[i] : l;
+    h = (element[i] > h) ? element[i] : h;
+  }
+
+  *(float *)min = l;
+  *(float *)max = h;
+}
+
+SSE2 static size_t sse2_find_8(const void *data, size_t count, const void *value)
+{
+  const uint8_t *element = (const uint8_t *)data;
+  const uint8_t v = *(const uint8_t *)value;
+  const __m128i key = _mm_set1_epi8((char)v);
+  size_t i = 0;
+
+  for (; i + 16 <= count; i += 16)
+  {
+    __m128i x = _mm_loadu_si128((const __m128i *)(element + i));
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, key));
+    if (0 != mask)
+    {
+      return i + first_bit(mask);
+    }
+  }
+
+  for (; i < count; i++)
+  {
+    if (element[i] == v)
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+
+SSE2 static size_t sse2_find_16(const void *data, size_t count, const void *value)
+{
+  const uint16_t *element = (const uint16_t *)data;
+  uint16_t v;
+  memcpy(&v, value, sizeof(v));
+  const __m128i key = _mm_set1_epi16((short)v);
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i x = _mm_loadu_si128((const __m128i *)(element + i));
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(x, key));
+    if (0 != mask)
+    {
+      return i + first_bit(mask) / 2;
+    }
+  }
+
+  for (; i < count; i++)
+  {
+    if (element[i] == v)
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+
+SSE2 static size_t sse2_find_32(const void *data, size_t count, const void *value)
+{
+  const uint32_t *element = (const uint32_t *)data;
+  uint32_t v;
+  memcpy(&v, value, sizeof(v));
+  const __m128i key = _mm_set1_epi32((int32_t)v);
+  size_t i = 0;
+
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i x = _mm_loadu_si128((const __m128i *)(element + i));
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi32(x, key));
+    if (0 != mask)
+    {
+      return i + first_bit(mask) / 4;
+    }
+  }
+
+  for (; i < count; i++)
+  {
+    if (element[i] == v)
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+
+SSE2 static size_t sse2_find_64(const void *data, size_t count, const void *value)
+{
+  const uint64_t *element = (const uint64_t *)data;
+  uint64_t v;
+  memcpy(&v, value, sizeof(v));
+  const __m128i key = _mm_set1_epi64x((long long)v);
+  size_t i = 0;
+
+  for (; i + 2 <= count; i += 2)
+  {
+    // There is no 64 bit comparison in SSE2: both 32 bit halves have to be equal
+    __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(element + i)), key);
+    eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+    if (0 != mask)
+    {
+      return i + first_bit(mask) / 8;
+    }
+  }
+
+  for (; i < count; i++)
+  {
+    if (element[i] == v)
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+
+//----- AVX2 ------------------------------------------------------------------
+
+AVX2 static void avx2_sum_i32(const void *data, size_t count, alg_acc_t *acc)
+{
+  const int32_t *element = (const int32_t *)data;
+  __m256i sum0 = _mm256_setzero_si256();
+  __m256i sum1 = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    sum0 = _mm256_add_epi64(sum0, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(element + i))));
+    sum1 = _mm256_add_epi64(sum1, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)(element + i + 4))));
+  }
+
+  int64_t lanes[4];
+  _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(sum0, sum1));
+  uint64_t total = (uint64_t)acc->i;
+  for (size_t j = 0; j < 4; j++)
+  {
+    total += (uint64_t)lanes[j];
+  }
+
+  for (; i < count; i++)
+  {
+    total += (uint64_t)(int64_t)element[i];
+  }
+
+  acc->i = (int64_t)total;
+}
+
+AVX2 static void avx2_sum_u32(const void *data, size_t count, alg_acc_t *acc)
+{
+  const uint32_t *element = (const uint32_t *)data;
+  __m256i sum0 = _mm256_setzero_si256();
+  __m256i sum1 = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    sum0 = _mm256_add_epi64(sum0, _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)(element + i))));
+    sum1 = _mm256_add_epi64(sum1, _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)(element + i + 4))));
+  }
+
+  uint64_t lanes[4];
+  _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(sum0, sum1));
+  acc->u += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+  for (; i < count; i++)
+  {
+    acc->u += element[i];
+  }
+}
+
+AVX2 static void avx2_sum_float(const void *data, size_t count, alg_acc_t *acc)
+{
+  const float *element = (const float *)data;
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    sum0 = _mm256_add_pd(sum0, _mm256_cvtps_pd(_mm_loadu_ps(element + i)));
+    sum1 = _mm256_add_pd(sum1, _mm256_cvtps_pd(_mm_loadu_ps(element + i + 4)));
+  }
+
+  double lanes[4];
+  _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+  acc->f += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+
+  for (; i < count; i++)
+  {
+    acc->f += element[i];
+  }
+}
+
+AVX2 static void avx2_sum_double(const void *data, size_t count, alg_acc_t *acc)
+{
+  const double *element = (const double *)data;
+  __m256d sum0 = _mm256_setzero_pd();
+  __m256d sum1 = _mm256_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    sum0 = _mm256_add_pd(sum0, _mm256_loadu_pd(element + i));
+    sum1 = _mm256_add_pd(sum1, _mm256_loadu_pd(element + i + 4));
+  }
+
+  double lanes[4];
+  _mm256_storeu_pd(lanes, _mm256_add_pd(sum0, sum1));
+  acc->f += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+
+  for (; i < count; i++)
+  {
+    acc->f += element[i];
+  }
+}
+
+AVX2 static void avx2_minmax_i32(const void *data, size_t count, void *min, void *max)
+{
+  const int32_t *element = (const int32_t *)data;
+  __m256i lo = _mm256_set1_epi32(*(int32_t *)min);
+  __m256i hi = _mm256_set1_epi32(*(int32_t *)max);
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(element + i));
+    lo = _mm256_min_epi32(lo, x);
+    hi = _mm256_max_epi32(hi, x);
+  }
+
+  int32_t lanes_lo[8];
+  int32_t lanes_hi[8];
+  _mm256_storeu_si256((__m256i *)lanes_lo, lo);
+  _mm256_storeu_si256((__m256i *)lanes_hi, hi);
+
+  int32_t l = lanes_lo[0];
+  int32_t h = lanes_hi[0];
+  for (size_t j = 1; j < 8; j++)
+  {
+    l = (lanes_lo[j] < l) ? lanes_lo[j] : l;
+    h = (lanes_hi[j] > h) ? lanes_hi[j] : h;
+  }
+
+  for (; i < count; i++)
+  {
+    l = (element[i] < l) ? element[i] : l;
+    h = (element[i] > h) ? element[i] : h;
+  }
+
+  *(int32_t *)min = l;
+  *(int32_t *)max = h;
+}
+
+AVX2 static void avx2_minmax_u32(const void *data, size_t count, void *min, void *max)
+{
+  const uint32_t *element = (const uint32_t *)data;
+  __m256i lo = _mm256_set1_epi32((int32_t) * (uint32_t *)min);
+  __m256i hi = _mm256_set1_epi32((int32_t) * (uint32_t *)max);
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(element + i));
+    lo = _mm256_min_epu32(lo, x);
+    hi = _mm256_max_epu32(hi, x);
+  }
+
+  uint32_t lanes_lo[8];
+  uint32_t lanes_hi[8];
+  _mm256_storeu_si256((__m256i *)lanes_lo, lo);
+  _mm256_storeu_si256((__m256i *)lanes_hi, hi);
+
+  uint32_t l = lanes_lo[0];
+  uint32_t h = lanes_hi[0];
+  for (size_t j = 1; j < 8; j++)
+  {
+    l = (lanes_lo[j] < l) ? lanes_lo[j] : l;
+    h = (lanes_hi[j] > h) ? lanes_hi[j] : h;
+  }
+
+  for (; i < count; i++)
+  {
+    l = (element[i] < l) ? element[i] : l;
+    h = (element[i] > h) ? element[i] : h;
+  }
+
+  *(uint32_t *)min = l;
+  *(uint32_t *)max = h;
+}
+
+AVX2 static void avx2_minmax_float(const void *data, size_t count, void *min, void *max)
+{
+  const float *element = (const float *)data;
+  __m256 lo = _mm256_set1_ps(*(float *)min);
+  __m256 hi = _mm256_set1_ps(*(float *)max);
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256 x = _mm256_loadu_ps(element + i);
+    lo = _mm256_min_ps(lo, x);
+    hi = _mm256_max_ps(hi, x);
+  }
+
+  float lanes_lo[8];
+  float lanes_hi[8];
+  _mm256_storeu_ps(lanes_lo, lo);
+  _mm256_storeu_ps(lanes_hi, hi);
+
+  float l = lanes_lo[0];
+  float h = lanes_hi[0];
+  for (size_t j = 1; j < 8; j++)
+  {
+    l = (lanes_lo[j] < l) ? lanes_lo[j] : l;
+    h = (lanes_hi[j] > h) ? lanes_hi[j] : h;
+  }
+
+  for (; i < count; i++)
+  {
+    l = (element[i] < l) ? element[i] : l;
+    h = (element[i] > h) ? element[i] : h;
+  }
+
+  *(float *)min = l;
+  *(float *)max = h;
+}
+
+/**
+ * \brief Find kernel for AVX2: `T` is the type of element, `SET1` and `CMPEQ` are the broadcast and the comparison for it.
+ */
+  #define AVX2_FIND(NAME, T, SET1, CMPEQ)                                          \
+    AVX2 static size_t NAME(const void *data, size_t count, const void *value)     \
+    {                                                                              \
+      const T *element = (const T *)data;                                          \
+      T v;                                                                         \
+      memcpy(&v, value, sizeof(T));                                                \
+      const __m256i key = SET1(v);                                                 \
+      const size_t lanes = sizeof(__m256i) / sizeof(T);                            \
+      size_t i = 0;                                                                \
+                                                                                   \
+      for (; i + lanes <= count; i += lanes)                                       \
+      {                                                                            \
+        __m256i x = _mm256_loadu_si256((const __m256i *)(element + i));            \
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(CMPEQ(x, key));             \
+        if (0 != mask)                                                             \
+        {                                                                          \
+          return i + first_bit(mask) / sizeof(T);                                  \
+        }                                                                          \
+      }                                                                            \
+                                                                                   \
+      for (; i < count; i++)                                                       \
+      {                                                                            \
+        if (element[i] == v)                                                       \
+        {                                                                          \
+          return i;                                                                \
+        }                                                                          \
+      }                                                                            \
+                                                                                   \
+      return count;                                                                \
+    }
+
+  #define SET1_8(v)  _mm256_set1_epi8((char)(v))
+  #define SET1_16(v) _mm256_set1_epi16((short)(v))
+  #define SET1_32(v) _mm256_set1_epi32((int)(v))
+  #define SET1_64(v) _mm256_set1_epi64x((long long)(v))
+
+AVX2_FIND(avx2_find_8, uint8_t, SET1_8, _mm256_cmpeq_epi8)
+AVX2_FIND(avx2_find_16, uint16_t, SET1_16, _mm256_cmpeq_epi16)
+AVX2_FIND(avx2_find_32, uint32_t, SET1_32, _mm256_cmpeq_epi32)
+AVX2_FIND(avx2_find_64, uint64_t, SET1_64, _mm256_cmpeq_epi64)
+
+//----- AVX-512 ---------------------------------------------------------------
+
+AVX512 static void avx512_sum_i32(const void *data, size_t count, alg_acc_t *acc)
+{
+  const int32_t *element = (const int32_t *)data;
+  __m512i sum0 = _mm512_setzero_si512();
+  __m512i sum1 = _mm512_setzero_si512();
+  size_t i = 0;
+
+  for (; i + 16 <= count; i += 16)
+  {
+    sum0 = _mm512_add_epi64(sum0, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)(element + i))));
+    sum1 = _mm512_add_epi64(sum1, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i *)(element + i + 8))));
+  }
+
+  uint64_t total = (uint64_t)acc->i + (uint64_t)_mm512_reduce_add_epi64(_mm512_add_epi64(sum0, sum1));
+
+  for (; i < count; i++)
+  {
+    total += (uint64_t)(int64_t)element[i];
+  }
+
+  acc->i = (int64_t)total;
+}
+
+AVX512 static void avx512_sum_u32(const void *data, size_t count, alg_acc_t *acc)
+{
+  const uint32_t *element = (const uint32_t *)data;
+  __m512i sum0 = _mm512_setzero_si512();
+  __m512i sum1 = _mm512_setzero_si512();
+  size_t i = 0;
+
+  for (; i + 16 <= count; i += 16)
+  {
+    sum0 = _mm512_add_epi64(sum0, _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *)(element + i))));
+    sum1 = _mm512_add_epi64(sum1, _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *)(element + i + 8))));
+  }
+
+  acc->u += (uint64_t)_mm512_reduce_add_epi64(_mm512_add_epi64(sum0, sum1));
+
+  for (; i < count; i++)
+  {
+    acc->u += element[i];
+  }
+}
+
+AVX512 static void avx512_sum_float(const void *data, size_t count, alg_acc_t *acc)
+{
+  const float *element = (const float *)data;
+  __m512d sum0 = _mm512_setzero_pd();
+  __m512d sum1 = _mm512_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 16 <= count; i += 16)
+  {
+    sum0 = _mm512_add_pd(sum0, _mm512_cvtps_pd(_mm256_loadu_ps(element + i)));
+    sum1 = _mm512_add_pd(sum1, _mm512_cvtps_pd(_mm256_loadu_ps(element + i + 8)));
+  }
+
+  acc->f += _mm512_reduce_add_pd(_mm512_add_pd(sum0, sum1));
+
+  for (; i < count; i++)
+  {
+    acc->f += element[i];
+  }
+}
+
+AVX512 static void avx512_minmax_i32(const void *data, size_t count, void *min, void *max)
+{
+  const int32_t *element = (const int32_t *)data;
+  __m512i lo = _mm512_set1_epi32(*(int32_t *)min);
+  __m512i hi = _mm512_set1_epi32(*(int32_t *)max);
+  size_t i = 0;
+
+  for (; i + 16 <= count; i += 16)
+  {
+    __m512i x = _mm512_loadu_si512((const void *)(element + i));
+    lo = _mm512_min_epi32(lo, x);
+    hi = _mm512_max_epi32(hi, x);
+  }
+
+  int32_t l = _mm512_reduce_min_epi32(lo);
+  int32_t h = _mm512_reduce_max_epi32(hi);
+
+  for (; i < count; i++)
+  {
+    l = (element[i] < l) ? element[i] : l;
+    h = (element[i] > h) ? element[i] : h;
+  }
+
+  *(int32_t *)min = l;
+  *(int32_t *)max = h;
+}
+
+AVX512 static void avx512_minmax_u32(const void *data, size_t count, void *min, void *max)
+{
+  const uint32_t *element = (const uint32_t *)data;
+  __m512i lo = _mm512_set1_epi32((int32_t) * (uint32_t *)min);
+  __m512i hi = _mm512_set1_epi32((int32_t) * (uint32_t *)max);
+  size_t i = 0;
+
+  for (; i + 16 <= count; i += 16)
+  {
+    __m512i x = _mm512_loadu_si512((const void *)(element + i));
+    lo = _mm512_min_epu32(lo, x);
+    hi = _mm512_max_epu32(hi, x);
+  }
+
+  uint32_t l = _mm512_reduce_min_epu32(lo);
+  uint32_t h = _mm512_reduce_max_epu32(hi);
+
+  for (; i < count; i++)
+  {
+    l = (element[i] < l) ? element[i] : l;
+    h = (element[i] > h) ? element[i] : h;
+  }
+
+  *(uint32_t *)min = l;
+  *(uint32_t *)max = h;
+}
+
+AVX512 static size_t avx512_find_32(const void *data, size_t count, const void *value)
+{
+  const uint32_t *element = (const uint32_t *)data;
+  uint32_t v;
+  memcpy(&v, value, sizeof(v));
+  const __m512i key = _mm512_set1_epi32((int32_t)v);
+  size_t i = 0;
+
+  for (; i + 16 <= count; i += 16)
+  {
+    __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void *)(element + i)), key);
+    if (0 != mask)
+    {
+      return i + first_bit(mask);
+    }
+  }
+
+  for (; i < count; i++)
+  {
+    if (element[i] == v)
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+
+AVX512 static size_t avx512_find_64(const void *data, size_t count, const void *value)
+{
+  const uint64_t *element = (const uint64_t *)data;
+  uint64_t v;
+  memcpy(&v, value, sizeof(v));
+  const __m512i key = _mm512_set1_epi64((long long)v);
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8)
+  {
+    __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_loadu_si512((const void *)(element + i)), key);
+    if (0 != mask)
+    {
+      return i + first_bit(mask);
+    }
+  }
+
+  for (; i < count; i++)
+  {
+    if (element[i] == v)
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Replaces the kernels by their SSE2 versions.
+ *
+ * Detailed description see in alg_kernels.h
+ */
+void alg_kernels_sse2(alg_kernels_t *kernels)
+{
+  kernels->sum[ALG_TYPE_I32] = sse2_sum_i32;
+  kernels->sum[ALG_TYPE_U32] = sse2_sum_u32;
+  kernels->sum[ALG_TYPE_FLOAT] = sse2_sum_float;
+  kernels->sum[ALG_TYPE_DOUBLE] = sse2_sum_double;
+
+  kernels->minmax[ALG_TYPE_I32] = sse2_minmax_i32;
+  kernels->minmax[ALG_TYPE_U32] = sse2_minmax_u32;
+  kernels->minmax[ALG_TYPE_FLOAT] = sse2_minmax_float;
+
+  kernels->find[0] = sse2_find_8;
+  kernels->find[1] = sse2_find_16;
+  kernels->find[2] = sse2_find_32;
+  kernels->find[3] = sse2_find_64;
+}
+
+/**
+ * \brief Replaces the kernels by their AVX2 versions.
+ *
+ * Detailed description see in alg_kernels.h
+ */
+void alg_kernels_avx2(alg_kernels_t *kernels)
+{
+  kernels->sum[ALG_TYPE_I32] = avx2_sum_i32;
+  kernels->sum[ALG_TYPE_U32] = avx2_sum_u32;
+  kernels->sum[ALG_TYPE_FLOAT] = avx2_sum_float;
+  kernels->sum[ALG_TYPE_DOUBLE] = avx2_sum_double;
+
+  kernels->minmax[ALG_TYPE_I32] = avx2_minmax_i32;
+  kernels->minmax[ALG_TYPE_U32] = avx2_minmax_u32;
+  kernels->minmax[ALG_TYPE_FLOAT] = avx2_minmax_float;
+
+  kernels->find[0] = avx2_find_8;
+  kernels->find[1] = avx2_find_16;
+  kernels->find[2] = avx2_find_32;
+  kernels->find[3] = avx2_find_64;
+}
+
+/**
+ * \brief Replaces the kernels by their AVX-512 versions.
+ *
+ * Detailed description see in alg_kernels.h
+ */
+void alg_kernels_avx512(alg_kernels_t *kernels)
+{
+  kernels->sum[ALG_TYPE_I32] = avx512_sum_i32;
+  kernels->sum[ALG_TYPE_U32] = avx512_sum_u32;
+  kernels->sum[ALG_TYPE_FLOAT] = avx512_sum_float;
+
+  kernels->minmax[ALG_TYPE_I32] = avx512_minmax_i32;
+  kernels->minmax[ALG_TYPE_U32] = avx512_minmax_u32;
+
+  kernels->find[2] = avx512_find_32;
+  kernels->find[3] = avx512_find_64;
+}
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * \file    alg_search.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Branchless binary search and search in the Eytzinger layout.
+ * \date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "algorithms.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_cursor.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Search tree in the Eytzinger layout: the children of the node `k` are the nodes `2k` and `2k + 1`.
+ */
+struct AlgEytzinger_t
+{
+  size_t count;
+  size_t esize;
+  uint8_t data[]; /**< Nodes `1..count`, the slot 0 is unused */
+};
+//_____ M A C R O S ___________________________________________________________
+#if defined(__GNUC__) || defined(__clang__)
+  #define ALG_PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+  #define ALG_PREFETCH(ptr) ((void)0)
+#endif
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Returns the element with logical index `i` of the storage which consists of two spans.
+ */
+static inline uint8_t *span_element(const ds_span_t *span, size_t esize, size_t i)
+{
+  bool second = (i >= span[0].count);
+  const ds_span_t *s = &span[second ? 1 : 0];
+  size_t index = second ? i - span[0].count : i;
+
+  return (uint8_t *)s->data + index * esize;
+}
+
+/**
+ * \brief Finds the first element which is not less than the key by the linear scan.
+ */
+static void *lower_bound_linear(const ds_t *ds, const void *key, alg_compare_t compare)
+{
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  void *element = NULL;
+  while (NULL != (element = ds_cursor_next(&cursor)))
+  {
+    if (compare(element, key) >= 0)
+    {
+      return element;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Copies the elements into the subtree of the node `k` by the in-order traversal.
+ */
+static void eytzinger_build(alg_eytzinger_t *tree, ds_cursor_t *cursor, size_t k)
+{
+  if (k > tree->count)
+  {
+    return;
+  }
+
+  eytzinger_build(tree, cursor, 2 * k);
+  memcpy(tree->data + k * tree->esize, ds_cursor_next(cursor), tree->esize);
+  eytzinger_build(tree, cursor, 2 * k + 1);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Finds the first element which is not less than the key.
+ *
+ * Detailed description see in algorithms.h
+ */
+void *alg_lower_bound(const ds_t *ds, const void *key, alg_compare_t compare)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(key);
+  UC_ASSERT(compare);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  ds_span_t span[2] = {{NULL, 0}, {NULL, 0}};
+  ds_span_t extra;
+  if (ds_cursor_next_span(&cursor, &span[0]) && ds_cursor_next_span(&cursor, &span[1]) &&
+      ds_cursor_next_span(&cursor, &extra))
+  {
+    return lower_bound_linear(ds, key, compare);
+  }
+
+  size_t count = span[0].count + span[1].count;
+  if (0 == count)
+  {
+    return NULL;
+  }
+
+  // The loop has the fixed number of iterations and the result of comparison only selects the next base
+  size_t base = 0;
+  for (size_t n = count; n > 1; n -= n / 2)
+  {
+    size_t half = n / 2;
+    base = (compare(span_element(span, cursor.esize, base + half), key) < 0) ? base + half : base;
+  }
+
+  base += (compare(span_element(span, cursor.esize, base), key) < 0) ? 1 : 0;
+
+  return (base < count) ? span_element(span, cursor.esize, base) : NULL;
+}
+
+/**
+ * \brief Creates the copy of the sorted data structure in the Eytzinger layout.
+ *
+ * Detailed description see in algorithms.h
+ */
+alg_eytzinger_t *alg_eytzinger_create(const ds_t *ds)
+{
+  UC_ASSERT(ds);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  size_t count = 0;
+  ds_span_t span;
+  while (ds_cursor_next_span(&cursor, &span))
+  {
+    count += span.count;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  alg_eytzinger_t *tree = (alg_eytzinger_t *)mem_allocate(sizeof(alg_eytzinger_t) + (count + 1) * cursor.esize);
+  if (NULL == tree)
+  {
+    return NULL;
+  }
+
+  tree->count = count;
+  tree->esize = cursor.esize;
+
+  ds_cursor_init(&cursor, ds);
+  eytzinger_build(tree, &cursor, 1);
+
+  return tree;
+}
+
+/**
+ * \brief Deletes the search tree.
+ *
+ * Detailed description see in algorithms.h
+ */
+void alg_eytzinger_delete(alg_eytzinger_t **tree)
+{
+  UC_ASSERT(tree);
+
+  if (NULL == *tree)
+  {
+    return;
+  }
+
+  free_fn_t mem_free = get_free();
+  mem_free(*tree);
+  *tree = NULL;
+}
+
+/**
+ * \brief Finds the first element of the search tree which is not less than the key.
+ *
+ * Detailed description see in algorithms.h
+ */
+const void *alg_eytzinger_search(const alg_eytzinger_t *tree, const void *key, alg_compare_t compare)
+{
+  UC_ASSERT(tree);
+  UC_ASSERT(key);
+  UC_ASSERT(compare);
+
+  size_t k = 1;
+  while (k <= tree->count)
+  {
+    // The 16 descendants of the node 4 levels below are adjacent, so they are fetched in advance
+    if (16 * k <= tree->count)
+    {
+      ALG_PREFETCH(tree->data + 16 * k * tree->esize);
+    }
+
+    k = 2 * k + ((compare(tree->data + k * tree->esize, key) < 0) ? 1 : 0);
+  }
+
+  // The answer is the last node where the search went left: drop the trailing right turns and that left turn
+  while (k & 1)
+  {
+    k >>= 1;
+  }
+  k >>= 1;
+
+  return (0 != k) ? tree->data + k * tree->esize : NULL;
+}
@@ -0,0 +1,534 @@
+/**
+ * \file    alg_sort.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Parallel merge sort and radix sort of data structures which support `ds_t` interface.
+ * \date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "algorithms.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "alg_kernels.h"
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_cursor.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 to build the library without threads: `alg_sort` always sorts in the calling thread */
+#ifndef ALG_USE_THREADS
+  #if defined(__unix__) || defined(__APPLE__)
+    #define ALG_USE_THREADS 1
+  #else
+    #define ALG_USE_THREADS 0
+  #endif
+#endif
+
+/** Min number of elements which are sorted in parallel */
+#ifndef ALG_SORT_PARALLEL_THRESHOLD
+  #define ALG_SORT_PARALLEL_THRESHOLD (1U << 16)
+#endif
+
+/** Max number of threads used by `alg_sort` */
+#ifndef ALG_SORT_MAX_THREADS
+  #define ALG_SORT_MAX_THREADS 64
+#endif
+
+#if ALG_USE_THREADS
+  #include <pthread.h>
+  #include <unistd.h>
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Elements of the data structure as one contiguous array.
+ */
+typedef struct
+{
+  ds_t *ds;
+  uint8_t *data;
+  size_t count;
+  size_t esize;
+  bool copied; /**< The array is the temporary copy which has to be written back into the data structure */
+} sort_array_t;
+
+/**
+ * \brief Part of the work of the parallel sort done by one thread.
+ *
+ * Sorting task sorts `a_count` elements of `a` in place. Merging task writes the elements
+ * `[first, last)` of the merged runs `a` and `b` into `dst`.
+ */
+typedef struct
+{
+  alg_compare_t compare;
+  size_t esize;
+  uint8_t *a;
+  size_t a_count;
+  const uint8_t *b;
+  size_t b_count;
+  uint8_t *dst;
+  size_t first;
+  size_t last;
+} sort_task_t;
+
+/** Thread function which does the task */
+typedef void *(*sort_worker_t)(void *task);
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Gets the elements as one array: the storage itself if it is a single span or its copy otherwise.
+ */
+static bool array_acquire(sort_array_t *array, ds_t *ds)
+{
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  array->ds = ds;
+  array->data = NULL;
+  array->count = 0;
+  array->esize = cursor.esize;
+  array->copied = false;
+
+  ds_span_t span;
+  if (!ds_cursor_next_span(&cursor, &span))
+  {
+    return true;
+  }
+
+  array->data = (uint8_t *)span.data;
+  array->count = span.count;
+
+  if (!ds_cursor_next_span(&cursor, &span))
+  {
+    return true;
+  }
+
+  do
+  {
+    array->count += span.count;
+  } while (ds_cursor_next_span(&cursor, &span));
+
+  if (!is_allocator_valid())
+  {
+    return false;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  array->data = (uint8_t *)mem_allocate(array->count * array->esize);
+  if (NULL == array->data)
+  {
+    return false;
+  }
+
+  alg_copy(ds, array->data, array->count);
+  array->copied = true;
+
+  return true;
+}
+
+/**
+ * \brief Writes the copy of the elements back into the storage of the data structure.
+ */
+static void array_release(sort_array_t *array)
+{
+  if (!array->copied)
+  {
+    return;
+  }
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, array->ds);
+
+  size_t offset = 0;
+  ds_span_t span;
+  while (ds_cursor_next_span(&cursor, &span))
+  {
+    memcpy(span.data, array->data + offset, span.count * array->esize);
+    offset += span.count * array->esize;
+  }
+
+  free_fn_t mem_free = get_free();
+  mem_free(array->data);
+}
+
+/**
+ * \brief Allocates the array of `count` elements of `esize` bytes.
+ */
+static uint8_t *scratch_allocate(size_t count, size_t esize)
+{
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  return (uint8_t *)mem_allocate(count * esize);
+}
+
+/**
+ * \brief Returns the number of elements from the run `a` among the first `position` elements of the merged runs.
+ *
+ * The merge takes the element from `a` if it is equal to the element from `b`.
+ */
+static size_t co_rank(const sort_task_t *task, size_t position)
+{
+  size_t lo = (position > task->b_count) ? position - task->b_count : 0;
+  size_t hi = (position < task->a_count) ? position : task->a_count;
+
+  while (lo < hi)
+  {
+    size_t i = lo + (hi - lo) / 2;
+    size_t j = position - i;
+
+    if (task->compare(task->a + i * task->esize, task->b + (j - 1) * task->esize) <= 0)
+    {
+      lo = i + 1;
+    }
+    else
+    {
+      hi = i;
+    }
+  }
+
+  return lo;
+}
+
+/**
+ * \brief Sorts the part of the array.
+ */
+static void *sort_worker(void *arg)
+{
+  sort_task_t *task = (sort_task_t *)arg;
+
+  qsort(task->a, task->a_count, task->esize, task->compare);
+
+  return NULL;
+}
+
+/**
+ * \brief Merges the part of two sorted runs.
+ */
+static void *merge_worker(void *arg)
+{
+  sort_task_t *task = (sort_task_t *)arg;
+  size_t esize = task->esize;
+
+  size_t a = co_rank(task, task->first);
+  size_t b = task->first - a;
+  size_t a_end = co_rank(task, task->last);
+  size_t b_end = task->last - a_end;
+  uint8_t *dst = task->dst + task->first * esize;
+
+  while (a < a_end && b < b_end)
+  {
+    if (task->compare(task->b + b * esize, task->a + a * esize) < 0)
+    {
+      memcpy(dst, task->b + b * esize, esize);
+      b++;
+    }
+    else
+    {
+      memcpy(dst, task->a + a * esize, esize);
+      a++;
+    }
+    dst += esize;
+  }
+
+  memcpy(dst, task->a + a * esize, (a_end - a) * esize);
+  dst += (a_end - a) * esize;
+  memcpy(dst, task->b + b * esize, (b_end - b) * esize);
+
+  return NULL;
+}
+
+/**
+ * \brief Does the tasks in parallel: the first one in the calling thread and the other ones in new threads.
+ */
+static void run_tasks(sort_worker_t worker, sort_task_t *tasks, size_t count)
+{
+#if ALG_USE_THREADS
+  pthread_t thread[ALG_SORT_MAX_THREADS];
+  bool started[ALG_SORT_MAX_THREADS] = {false};
+
+  for (size_t i = 1; i < count; i++)
+  {
+    started[i] = (0 == pthread_create(&thread[i], NULL, worker, &tasks[i]));
+    if (!started[i])
+    {
+      worker(&tasks[i]);
+    }
+  }
+
+  worker(&tasks[0]);
+
+  for (size_t i = 1; i < count; i++)
+  {
+    if (started[i])
+    {
+      pthread_join(thread[i], NULL);
+    }
+  }
+#else
+  for (size_t i = 0; i < count; i++)
+  {
+    worker(&tasks[i]);
+  }
+#endif
+}
+
+/**
+ * \brief Returns the number of parts to sort in parallel.
+ */
+static size_t sort_parts(size_t count, size_t threads)
+{
+#if ALG_USE_THREADS
+  if (count < ALG_SORT_PARALLEL_THRESHOLD)
+  {
+    return 1;
+  }
+
+  if (0 == threads)
+  {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = (online > 0) ? (size_t)online : 1;
+  }
+
+  return (threads < ALG_SORT_MAX_THREADS) ? threads : ALG_SORT_MAX_THREADS;
+#else
+  (void)count;
+  (void)threads;
+  return 1;
+#endif
+}
+
+/**
+ * \brief Sorts the parts of the array in parallel and then merges them pairwise.
+ *
+ * Every merge round is split into `parts` tasks of equal size, so all threads are busy until the end.
+ */
+static bool parallel_sort(sort_array_t *array, alg_compare_t compare, size_t parts)
+{
+  sort_task_t tasks[ALG_SORT_MAX_THREADS];
+  size_t bound[ALG_SORT_MAX_THREADS + 1];
+  size_t esize = array->esize;
+
+  uint8_t *scratch = scratch_allocate(array->count, esize);
+  if (NULL == scratch)
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i <= parts; i++)
+  {
+    bound[i] = (array->count / parts) * i + ((i < array->count % parts) ? i : array->count % parts);
+  }
+
+  for (size_t i = 0; i < parts; i++)
+  {
+    memset(&tasks[i], 0, sizeof(tasks[i]));
+    tasks[i].compare = compare;
+    tasks[i].esize = esize;
+    tasks[i].a = array->data + bound[i] * esize;
+    tasks[i].a_count = bound[i + 1] - bound[i];
+  }
+
+  run_tasks(sort_worker, tasks, parts);
+
+  uint8_t *src = array->data;
+  uint8_t *dst = scratch;
+
+  for (size_t width = 1; width < parts; width *= 2)
+  {
+    size_t pairs = (parts + 2 * width - 1) / (2 * width);
+    size_t pieces = parts / pairs;
+    size_t n = 0;
+
+    for (size_t i = 0; i < parts; i += 2 * width)
+    {
+      size_t begin = bound[i];
+      size_t middle = bound[(i + width < parts) ? i + width : parts];
+      size_t end = bound[(i + 2 * width < parts) ? i + 2 * width : parts];
+      size_t length = end - begin;
+
+      for (size_t k = 0; k < pieces; k++, n++)
+      {
+        tasks[n].compare = compare;
+        tasks[n].esize = esize;
+        tasks[n].a = src + begin * esize;
+        tasks[n].a_count = middle - begin;
+        tasks[n].b = src + middle * esize;
+        tasks[n].b_count = end - middle;
+        tasks[n].dst = dst + begin * esize;
+        tasks[n].first = (length / pieces) * k;
+        tasks[n].last = (k + 1 == pieces) ? length : (length / pieces) * (k + 1);
+      }
+    }
+
+    run_tasks(merge_worker, tasks, n);
+
+    uint8_t *tmp = src;
+    src = dst;
+    dst = tmp;
+  }
+
+  if (src != array->data)
+  {
+    memcpy(array->data, src, array->count * esize);
+  }
+
+  free_fn_t mem_free = get_free();
+  mem_free(scratch);
+
+  return true;
+}
+
+/**
+ * \brief Returns the key of the element as unsigned integer with the same order as the key.
+ */
+static uint64_t radix_key(const uint8_t *element, alg_type_t type)
+{
+  alg_value_t key;
+  memcpy(&key, element, alg_type_size[type]);
+
+  switch (type)
+  {
+    case ALG_TYPE_I8: return (uint8_t)key.i8 ^ 0x80U;
+    case ALG_TYPE_U8: return key.u8;
+    case ALG_TYPE_I16: return (uint16_t)key.i16 ^ 0x8000U;
+    case ALG_TYPE_U16: return key.u16;
+    case ALG_TYPE_I32: return (uint32_t)key.i32 ^ 0x80000000U;
+    case ALG_TYPE_U32: return key.u32;
+    case ALG_TYPE_I64: return (uint64_t)key.i64 ^ 0x8000000000000000ULL;
+    case ALG_TYPE_U64: return key.u64;
+    case ALG_TYPE_FLOAT:
+      // Negative numbers are ordered in reverse, so all their bits are inverted
+      return (key.u32 & 0x80000000U) ? (uint32_t)~key.u32 : (key.u32 | 0x80000000U);
+    case ALG_TYPE_DOUBLE:
+      return (key.u64 & 0x8000000000000000ULL) ? ~key.u64 : (key.u64 | 0x8000000000000000ULL);
+    default: return 0;
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Sorts the elements by the comparator.
+ *
+ * Detailed description see in algorithms.h
+ */
+bool alg_sort(ds_t *ds, alg_compare_t compare, size_t threads)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(compare);
+
+  sort_array_t array;
+  if (!array_acquire(&array, ds))
+  {
+    return false;
+  }
+
+  size_t parts = sort_parts(array.count, threads);
+
+  // Falls back to the sort in the calling thread if there is no memory for the merge
+  if (array.count > 1 && (parts <= 1 || !parallel_sort(&array, compare, parts)))
+  {
+    qsort(array.data, array.count, array.esize, compare);
+  }
+
+  array_release(&array);
+
+  return true;
+}
+
+/**
+ * \brief Sorts the elements by the numeric key.
+ *
+ * Detailed description see in algorithms.h
+ */
+bool alg_radix_sort(ds_t *ds, alg_type_t type, size_t offset)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(type < ALG_TYPE_COUNT);
+  UC_ASSERT(offset + alg_type_size[type] <= ds->iface->esize(ds));
+
+  sort_array_t array;
+  if (!array_acquire(&array, ds))
+  {
+    return false;
+  }
+
+  if (array.count < 2)
+  {
+    array_release(&array);
+    return true;
+  }
+
+  uint8_t *scratch = scratch_allocate(array.count, array.esize);
+  if (NULL == scratch)
+  {
+    array_release(&array);
+    return false;
+  }
+
+  size_t digits = alg_type_size[type];
+  size_t esize = array.esize;
+  size_t histogram[sizeof(uint64_t)][256];
+  memset(histogram, 0, sizeof(histogram));
+
+  // Histograms of all digits are built by one pass
+  for (size_t i = 0; i < array.count; i++)
+  {
+    uint64_t key = radix_key(array.data + i * esize + offset, type);
+    for (size_t d = 0; d < digits; d++)
+    {
+      histogram[d][(key >> (8 * d)) & 0xFF]++;
+    }
+  }
+
+  uint8_t *src = array.data;
+  uint8_t *dst = scratch;
+
+  for (size_t d = 0; d < digits; d++)
+  {
+    uint64_t first = radix_key(src + offset, type);
+    if (histogram[d][(first >> (8 * d)) & 0xFF] == array.count)
+    {
+      // All elements have the same digit, the pass wouldn't change the order
+      continue;
+    }
+
+    size_t position[256];
+    size_t sum = 0;
+    for (size_t b = 0; b < 256; b++)
+    {
+      position[b] = sum;
+      sum += histogram[d][b];
+    }
+
+    for (size_t i = 0; i < array.count; i++)
+    {
+      const uint8_t *element = src + i * esize;
+      size_t b = (radix_key(element + offset, type) >> (8 * d)) & 0xFF;
+      memcpy(dst + position[b] * esize, element, esize);
+      position[b]++;
+    }
+
+    uint8_t *tmp = src;
+    src = dst;
+    dst = tmp;
+  }
+
+  if (src != array.data)
+  {
+    memcpy(array.data, src, array.count * esize);
+  }
+
+  free_fn_t mem_free = get_free();
+  mem_free(scratch);
+
+  array_release(&array);
+
+  return true;
+}
@@ -0,0 +1,282 @@
+/**
+ * \file    algorithms.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Generic algorithms which work with any data structure which supports `ds_t` interface.
+ * \date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "algorithms.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "alg_kernels.h"
+#include "common/uc_assert.h"
+#include "structs/ds_cursor.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Returns the index of the find kernel for the size of element or -1 if there is no such kernel.
+ */
+static int find_kernel_index(size_t esize)
+{
+  switch (esize)
+  {
+    case 1: return 0;
+    case 2: return 1;
+    case 4: return 2;
+    case 8: return 3;
+    default: return -1;
+  }
+}
+
+/**
+ * \brief Returns the index of the first element of the span which is bitwise equal to the value.
+ */
+static size_t find_generic(const void *data, size_t count, size_t esize, const void *value)
+{
+  const uint8_t *element = (const uint8_t *)data;
+
+  for (size_t i = 0; i < count; i++, element += esize)
+  {
+    if (0 == memcmp(element, value, esize))
+    {
+      return i;
+    }
+  }
+
+  return count;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Calculates the sum of all elements.
+ *
+ * Detailed description see in algorithms.h
+ */
+bool alg_sum(const ds_t *ds, alg_type_t type, void *result)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(result);
+  UC_ASSERT(type < ALG_TYPE_COUNT);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  if (cursor.esize != alg_type_size[type])
+  {
+    return false;
+  }
+
+  alg_sum_fn_t sum = alg_kernels()->sum[type];
+  alg_acc_t acc;
+  memset(&acc, 0, sizeof(acc));
+
+  ds_span_t span;
+  while (ds_cursor_next_span(&cursor, &span))
+  {
+    sum(span.data, span.count, &acc);
+  }
+
+  switch (type)
+  {
+    case ALG_TYPE_I8:
+    case ALG_TYPE_I16:
+    case ALG_TYPE_I32:
+    case ALG_TYPE_I64: memcpy(result, &acc.i, sizeof(acc.i)); break;
+    case ALG_TYPE_FLOAT:
+    case ALG_TYPE_DOUBLE: memcpy(result, &acc.f, sizeof(acc.f)); break;
+    default: memcpy(result, &acc.u, sizeof(acc.u)); break;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Finds the smallest and the largest elements.
+ *
+ * Detailed description see in algorithms.h
+ */
+bool alg_minmax(const ds_t *ds, alg_type_t type, void *min, void *max)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(type < ALG_TYPE_COUNT);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  if (cursor.esize != alg_type_size[type])
+  {
+    return false;
+  }
+
+  const void *first = ds_cursor_next(&cursor);
+  if (NULL == first)
+  {
+    return false;
+  }
+
+  alg_value_t lo;
+  alg_value_t hi;
+  memcpy(&lo, first, cursor.esize);
+  memcpy(&hi, first, cursor.esize);
+
+  alg_minmax_fn_t minmax = alg_kernels()->minmax[type];
+
+  ds_span_t span;
+  while (ds_cursor_next_span(&cursor, &span))
+  {
+    minmax(span.data, span.count, &lo, &hi);
+  }
+
+  if (NULL != min)
+  {
+    memcpy(min, &lo, cursor.esize);
+  }
+
+  if (NULL != max)
+  {
+    memcpy(max, &hi, cursor.esize);
+  }
+
+  return true;
+}
+
+/**
+ * \brief Finds the smallest element.
+ *
+ * Detailed description see in algorithms.h
+ */
+bool alg_min(const ds_t *ds, alg_type_t type, void *result)
+{
+  UC_ASSERT(result);
+
+  return alg_minmax(ds, type, result, NULL);
+}
+
+/**
+ * \brief Finds the largest element.
+ *
+ * Detailed description see in algorithms.h
+ */
+bool alg_max(const ds_t *ds, alg_type_t type, void *result)
+{
+  UC_ASSERT(result);
+
+  return alg_minmax(ds, type, NULL, result);
+}
+
+/**
+ * \brief Counts the elements which satisfy the predicate.
+ *
+ * Detailed description see in algorithms.h
+ */
+size_t alg_count_if(const ds_t *ds, alg_predicate_t predicate, void *ctx)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(predicate);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  size_t count = 0;
+  const void *element = NULL;
+  while (NULL != (element = ds_cursor_next(&cursor)))
+  {
+    count += predicate(element, ctx) ? 1 : 0;
+  }
+
+  return count;
+}
+
+/**
+ * \brief Finds the first element which is equal to the value.
+ *
+ * Detailed description see in algorithms.h
+ */
+void *alg_find(const ds_t *ds, const void *value)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(value);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  int index = find_kernel_index(cursor.esize);
+  alg_find_fn_t find = (index >= 0) ? alg_kernels()->find[index] : NULL;
+
+  ds_span_t span;
+  while (ds_cursor_next_span(&cursor, &span))
+  {
+    size_t i = (NULL != find) ? find(span.data, span.count, value) : find_generic(span.data, span.count, cursor.esize, value);
+    if (i < span.count)
+    {
+      return (uint8_t *)span.data + i * cursor.esize;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Assigns the value to all elements.
+ *
+ * Detailed description see in algorithms.h
+ */
+size_t alg_fill(ds_t *ds, const void *value)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(value);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  size_t count = 0;
+  ds_span_t span;
+  while (ds_cursor_next_span(&cursor, &span))
+  {
+    uint8_t *data = (uint8_t *)span.data;
+    size_t size = span.count * cursor.esize;
+
+    // Copy the first element and then double the filled part until the whole span is filled
+    memcpy(data, value, cursor.esize);
+    for (size_t filled = cursor.esize; filled < size; filled *= 2)
+    {
+      memcpy(data + filled, data, (filled <= size - filled) ? filled : size - filled);
+    }
+
+    count += span.count;
+  }
+
+  return count;
+}
+
+/**
+ * \brief Copies the elements into the array.
+ *
+ * Detailed description see in algorithms.h
+ */
+size_t alg_copy(const ds_t *ds, void *dst, size_t max)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(dst);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, ds);
+
+  size_t count = 0;
+  ds_span_t span;
+  while (count < max && ds_cursor_next_span(&cursor, &span))
+  {
+    size_t n = (span.count <= max - count) ? span.count : max - count;
+    memcpy((uint8_t *)dst + count * cursor.esize, span.data, n * cursor.esize);
+    count += n;
+  }
+
+  return count;
+}
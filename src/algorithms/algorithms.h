@@ -0,0 +1,230 @@
+/**
+ * \file    algorithms.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Generic algorithms which work with any data structure which supports `ds_t` interface.
+ * \date    2026-10-18
+ *
+ * The algorithms walk the storage of data structure by contiguous spans (see `structs/ds_cursor.h`) and
+ * process every span by the kernel for the type of elements. The kernels for the most common types use
+ * SSE2/AVX2/AVX-512 instructions if they are supported by the CPU at runtime.
+ *
+ * The algorithms work with the storage order of elements (see `ds_iface_t`), which is the order of retrieval
+ * for the queue and the ring buffer and the reverse one for the stack: the sorted stack has the smallest
+ * element at the bottom. Data structures whose storage is not a single span are sorted in a temporary array
+ * which is copied back into the storage.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "structs/ds.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Types of elements supported by the numeric algorithms.
+ */
+typedef enum
+{
+  ALG_TYPE_I8 = 0,
+  ALG_TYPE_U8,
+  ALG_TYPE_I16,
+  ALG_TYPE_U16,
+  ALG_TYPE_I32,
+  ALG_TYPE_U32,
+  ALG_TYPE_I64,
+  ALG_TYPE_U64,
+  ALG_TYPE_FLOAT,
+  ALG_TYPE_DOUBLE,
+  ALG_TYPE_COUNT,
+} alg_type_t;
+
+/**
+ * \brief Predicate for `alg_count_if`.
+ *
+ * \param[in] element Pointer to the element.
+ * \param[in] ctx User context passed to `alg_count_if`.
+ * \return true if the element has to be counted.
+ */
+typedef bool (*alg_predicate_t)(const void *element, void *ctx);
+
+/**
+ * \brief Comparator for the sorting and searching algorithms.
+ *
+ * \param[in] a Pointer to the first element.
+ * \param[in] b Pointer to the second element.
+ * \return Negative value if `a` is less than `b`, 0 if they are equal and positive value otherwise.
+ */
+typedef int (*alg_compare_t)(const void *a, const void *b);
+
+/**
+ * \brief Opaque search tree in the Eytzinger (breadth-first) layout.
+ */
+typedef struct AlgEytzinger_t alg_eytzinger_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Calculates the sum of all elements of the data structure.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] type Type of the elements. Its size has to be equal to the size of the element.
+ * \param[out] result Pointer to the sum: `int64_t` for signed integer types, `uint64_t` for unsigned
+ *                    integer types and `double` for floating point types. Integer sums wrap around on overflow.
+ *
+ * \note The floating point sum is accumulated in several lanes, so it may differ from the sequential sum
+ *       in the last bits.
+ * \return true if the operation was successful, false otherwise.
+ */
+bool alg_sum(const ds_t *ds, alg_type_t type, void *result);
+
+/**
+ * \brief Finds the smallest and the largest elements of the data structure.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] type Type of the elements. Its size has to be equal to the size of the element.
+ * \param[out] min Pointer to the variable of type `type` for the smallest element or NULL.
+ * \param[out] max Pointer to the variable of type `type` for the largest element or NULL.
+ *
+ * \note The result for floating point elements which contain NaN is unspecified.
+ * \return true if the operation was successful, false if the data structure is empty.
+ */
+bool alg_minmax(const ds_t *ds, alg_type_t type, void *min, void *max);
+
+/**
+ * \brief Finds the smallest element of the data structure.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] type Type of the elements. Its size has to be equal to the size of the element.
+ * \param[out] result Pointer to the variable of type `type` for the smallest element.
+ * \return true if the operation was successful, false if the data structure is empty.
+ */
+bool alg_min(const ds_t *ds, alg_type_t type, void *result);
+
+/**
+ * \brief Finds the largest element of the data structure.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] type Type of the elements. Its size has to be equal to the size of the element.
+ * \param[out] result Pointer to the variable of type `type` for the largest element.
+ * \return true if the operation was successful, false if the data structure is empty.
+ */
+bool alg_max(const ds_t *ds, alg_type_t type, void *result);
+
+/**
+ * \brief Counts the elements of the data structure which satisfy the predicate.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] predicate Predicate which is called for every element.
+ * \param[in] ctx User context which is passed to the predicate.
+ * \return Number of the elements which satisfy the predicate.
+ */
+size_t alg_count_if(const ds_t *ds, alg_predicate_t predicate, void *ctx);
+
+/**
+ * \brief Finds the first element of the data structure which is bitwise equal to the value.
+ *
+ * The elements are checked in the storage order, i.e. from the bottom for the stack.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] value Pointer to the value of the same size as the element.
+ * \return Pointer to the element in the storage of the data structure or NULL if it is not found.
+ */
+void *alg_find(const ds_t *ds, const void *value);
+
+/**
+ * \brief Assigns the value to all elements of the data structure.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] value Pointer to the value of the same size as the element.
+ * \return Number of the assigned elements.
+ */
+size_t alg_fill(ds_t *ds, const void *value);
+
+/**
+ * \brief Copies the elements of the data structure into the array.
+ *
+ * The elements are copied in the storage order, i.e. from the bottom for the stack.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[out] dst Pointer to the array.
+ * \param[in] max Max number of the elements which fit into the array.
+ * \return Number of the copied elements.
+ */
+size_t alg_copy(const ds_t *ds, void *dst, size_t max);
+
+/**
+ * \brief Sorts the elements of the data structure by the comparator.
+ *
+ * The elements are split into `threads` parts which are sorted in parallel and then merged pairwise also
+ * in parallel. Small data structures (see `ALG_SORT_PARALLEL_THRESHOLD`) are sorted by the calling thread.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] compare Comparator of the elements.
+ * \param[in] threads Max number of threads or 0 to use all online CPUs. It is ignored if the library is
+ *                    built without threads (`ALG_USE_THREADS` is 0).
+ *
+ * \note The sort is not stable.
+ * \return true if the operation was successful, false if there is no memory for the temporary array.
+ */
+bool alg_sort(ds_t *ds, alg_compare_t compare, size_t threads);
+
+/**
+ * \brief Sorts the elements of the data structure by the numeric key in ascending order.
+ *
+ * The LSD radix sort by bytes of the key which is stable and takes linear time. It is much faster than
+ * `alg_sort` for integer and floating point keys.
+ *
+ * \param[in] ds Pointer to the data structure.
+ * \param[in] type Type of the key.
+ * \param[in] offset Offset of the key from the beginning of the element. The key has to fit into the element.
+ *
+ * \note Negative zero is ordered before positive zero and NaNs are ordered by their bits.
+ * \return true if the operation was successful, false if there is no memory for the temporary array.
+ */
+bool alg_radix_sort(ds_t *ds, alg_type_t type, size_t offset);
+
+/**
+ * \brief Finds the first element of the sorted data structure which is not less than the key.
+ *
+ * The branchless binary search for data structures whose storage consists of one or two spans (stack and
+ * ring buffer). The other data structures are searched linearly.
+ *
+ * \param[in] ds Pointer to the data structure which is sorted by the comparator.
+ * \param[in] key Pointer to the key which is passed to the comparator as the second argument.
+ * \param[in] compare Comparator of the elements.
+ * \return Pointer to the element in the storage of the data structure or NULL if all elements are less than the key.
+ */
+void *alg_lower_bound(const ds_t *ds, const void *key, alg_compare_t compare);
+
+/**
+ * \brief Creates the copy of the sorted data structure in the Eytzinger layout.
+ *
+ * The layout places the elements which are compared one after another close to each other, so the search
+ * in large arrays causes much less cache misses than the binary search. It is useful for the data which
+ * is searched many times after it was built.
+ *
+ * \param[in] ds Pointer to the data structure which is sorted by the comparator used for the search.
+ * \return Pointer to the search tree or NULL if there is no memory.
+ */
+alg_eytzinger_t *alg_eytzinger_create(const ds_t *ds);
+
+/**
+ * \brief Deletes the search tree.
+ *
+ * \param[in,out] tree Pointer to the pointer to the search tree. It is set to NULL.
+ */
+void alg_eytzinger_delete(alg_eytzinger_t **tree);
+
+/**
+ * \brief Finds the first element of the search tree which is not less than the key.
+ *
+ * \param[in] tree Pointer to the search tree.
+ * \param[in] key Pointer to the key which is passed to the comparator as the second argument.
+ * \param[in] compare Comparator of the elements.
+ * \return Pointer to the element in the search tree or NULL if all elements are less than the key.
+ */
+const void *alg_eytzinger_search(const alg_eytzinger_t *tree, const void *key, alg_compare_t compare);
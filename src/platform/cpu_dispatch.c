@@ -0,0 +1,151 @@
+/**
+ * @file    cpu_dispatch.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Runtime detection of the CPU features used to select SIMD kernels.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "cpu_dispatch.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+//_____ C O N F I G S  ________________________________________________________
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define CPU_DETECT_X86 1
+#else
+  #define CPU_DETECT_X86 0
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+/** Features which are added by every level */
+static const uint32_t level_features[CPU_LEVEL_COUNT] = {
+  [CPU_LEVEL_SCALAR] = 0,
+  [CPU_LEVEL_SSE2] = CPU_FEATURE_SSE2,
+  [CPU_LEVEL_SSE42] = CPU_FEATURE_SSE42 | CPU_FEATURE_POPCNT,
+  [CPU_LEVEL_AVX2] = CPU_FEATURE_AVX2 | CPU_FEATURE_BMI2,
+  [CPU_LEVEL_AVX512] = CPU_FEATURE_AVX512F | CPU_FEATURE_AVX512BW,
+};
+
+static const char *const level_name[CPU_LEVEL_COUNT] = {
+  [CPU_LEVEL_SCALAR] = "scalar",
+  [CPU_LEVEL_SSE2] = "sse2",
+  [CPU_LEVEL_SSE42] = "sse4.2",
+  [CPU_LEVEL_AVX2] = "avx2",
+  [CPU_LEVEL_AVX512] = "avx512",
+};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Returns the features supported by the CPU.
+ */
+static uint32_t detect_features(void)
+{
+  uint32_t features = 0;
+
+#if CPU_DETECT_X86
+  __builtin_cpu_init();
+
+  features |= __builtin_cpu_supports("sse2") ? CPU_FEATURE_SSE2 : 0;
+  features |= __builtin_cpu_supports("sse4.2") ? CPU_FEATURE_SSE42 : 0;
+  features |= __builtin_cpu_supports("popcnt") ? CPU_FEATURE_POPCNT : 0;
+  features |= __builtin_cpu_supports("avx2") ? CPU_FEATURE_AVX2 : 0;
+  features |= __builtin_cpu_supports("bmi2") ? CPU_FEATURE_BMI2 : 0;
+  features |= __builtin_cpu_supports("avx512f") ? CPU_FEATURE_AVX512F : 0;
+  features |= __builtin_cpu_supports("avx512bw") ? CPU_FEATURE_AVX512BW : 0;
+#endif
+
+  return features;
+}
+
+/**
+ * @brief Returns the features allowed by `UDS_CPU_DISPATCH` or all features if it is not set or invalid.
+ */
+static uint32_t allowed_features(void)
+{
+  const char *value = getenv(CPU_DISPATCH_ENV);
+  if (NULL == value)
+  {
+    return UINT32_MAX;
+  }
+
+  uint32_t allowed = 0;
+  for (size_t level = 0; level < CPU_LEVEL_COUNT; level++)
+  {
+    allowed |= level_features[level];
+
+    if (0 == strcmp(value, level_name[level]))
+    {
+      return allowed;
+    }
+  }
+
+  return UINT32_MAX;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Returns the set of the CPU features which can be used by the kernels.
+ *
+ * Detailed description see in cpu_dispatch.h
+ */
+uint32_t cpu_features(void)
+{
+  // The features never include all bits, so UINT32_MAX marks that they aren't detected yet
+  static _Atomic uint32_t features = UINT32_MAX;
+
+  uint32_t result = atomic_load_explicit(&features, memory_order_relaxed);
+  if (UINT32_MAX == result)
+  {
+    // Concurrent first calls detect and store the same value
+    result = detect_features() & allowed_features();
+    atomic_store_explicit(&features, result, memory_order_relaxed);
+  }
+
+  return result;
+}
+
+/**
+ * @brief Checks whether the CPU feature can be used by the kernels.
+ *
+ * Detailed description see in cpu_dispatch.h
+ */
+bool cpu_has(cpu_feature_t feature)
+{
+  return (cpu_features() & (uint32_t)feature) == (uint32_t)feature;
+}
+
+/**
+ * @brief Returns the highest level of instructions which can be used by the kernels.
+ *
+ * Detailed description see in cpu_dispatch.h
+ */
+cpu_level_t cpu_level(void)
+{
+  uint32_t features = cpu_features();
+  cpu_level_t level = CPU_LEVEL_SCALAR;
+
+  while (level + 1 < CPU_LEVEL_COUNT && (features & level_features[level + 1]) == level_features[level + 1])
+  {
+    level++;
+  }
+
+  return level;
+}
+
+/**
+ * @brief Returns the name of the level.
+ *
+ * Detailed description see in cpu_dispatch.h
+ */
+const char *cpu_level_name(cpu_level_t level)
+{
+  UC_ASSERT(level < CPU_LEVEL_COUNT);
+
+  return level_name[level];
+}
@@ -0,0 +1,84 @@
+/**
+ * @file    cpu_dispatch.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Runtime detection of the CPU features used to select SIMD kernels.
+ * @date    2026-10-18
+ *
+ * The features are detected once, on the first call of any function of this module, so the same binary
+ * uses the best kernels on every CPU. Modules with SIMD kernels bind their function pointers by
+ * `cpu_has`/`cpu_level` instead of querying the CPU by themselves.
+ *
+ * The environment variable `UDS_CPU_DISPATCH` caps the level of used instructions for testing of every
+ * kernel on one machine: `scalar`, `sse2`, `sse4.2`, `avx2` or `avx512`. The level can only be lowered:
+ * features which are not supported by the CPU are never reported.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Name of the environment variable which caps the level of used instructions */
+#ifndef CPU_DISPATCH_ENV
+  #define CPU_DISPATCH_ENV "UDS_CPU_DISPATCH"
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief CPU features which are used by the kernels. Values are bits of `cpu_features()`.
+ */
+typedef enum
+{
+  CPU_FEATURE_SSE2 = 1U << 0,
+  CPU_FEATURE_SSE42 = 1U << 1,
+  CPU_FEATURE_POPCNT = 1U << 2,
+  CPU_FEATURE_AVX2 = 1U << 3,
+  CPU_FEATURE_BMI2 = 1U << 4,
+  CPU_FEATURE_AVX512F = 1U << 5,
+  CPU_FEATURE_AVX512BW = 1U << 6,
+} cpu_feature_t;
+
+/**
+ * @brief Levels of instructions. Every level includes the features of the previous ones.
+ */
+typedef enum
+{
+  CPU_LEVEL_SCALAR = 0, /**< No SIMD instructions */
+  CPU_LEVEL_SSE2,       /**< SSE2 */
+  CPU_LEVEL_SSE42,      /**< SSE4.2 and POPCNT */
+  CPU_LEVEL_AVX2,       /**< AVX2 and BMI2 */
+  CPU_LEVEL_AVX512,     /**< AVX-512F and AVX-512BW */
+  CPU_LEVEL_COUNT,
+} cpu_level_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Returns the set of the CPU features which can be used by the kernels.
+ *
+ * @return Bitwise OR of `cpu_feature_t` values.
+ */
+uint32_t cpu_features(void);
+
+/**
+ * @brief Checks whether the CPU feature can be used by the kernels.
+ *
+ * @param[in] feature The feature.
+ * @return true if the feature is supported and is not disabled by `UDS_CPU_DISPATCH`.
+ */
+bool cpu_has(cpu_feature_t feature);
+
+/**
+ * @brief Returns the highest level of instructions all features of which can be used by the kernels.
+ *
+ * @return The level of instructions.
+ */
+cpu_level_t cpu_level(void);
+
+/**
+ * @brief Returns the name of the level which is accepted by `UDS_CPU_DISPATCH`.
+ *
+ * @param[in] level The level of instructions.
+ * @return The name of the level.
+ */
+const char *cpu_level_name(cpu_level_t level);
@@ -0,0 +1,286 @@
+/**
+ * @file    mem_pages.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Allocation of large buffers directly from the OS with control of page size and NUMA node.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE
+#endif
+
+#include "mem_pages.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "common/uc_assert.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+  #include <sys/syscall.h>
+#endif
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 to build the library without mapping of the buffers, `mem_pages_alloc` then returns NULL */
+#ifndef MEM_PAGES_USE_MMAP
+  #if defined(__unix__) || defined(__APPLE__)
+    #define MEM_PAGES_USE_MMAP 1
+  #else
+    #define MEM_PAGES_USE_MMAP 0
+  #endif
+#endif
+
+/** Max number of NUMA nodes which can be selected */
+#ifndef MEM_MAX_NODES
+  #define MEM_MAX_NODES 1024
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/** Memory policy of `mbind` which allocates pages only on the nodes of the mask, see numaif.h */
+#define MEM_MPOL_BIND 2
+
+#define MEM_ULONG_BITS (8U * sizeof(unsigned long))
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if MEM_PAGES_USE_MMAP
+/**
+ * @brief Returns the size of the default page.
+ */
+static size_t page_size(void)
+{
+  return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+/**
+ * @brief Rounds `size` up to the multiple of `align` which is the power of two.
+ */
+static size_t align_up(size_t size, size_t align)
+{
+  return (size + align - 1) & ~(align - 1);
+}
+
+/**
+ * @brief Maps explicit huge pages.
+ */
+static void *map_huge(size_t size)
+{
+#if defined(MAP_HUGETLB)
+  void *addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  return (MAP_FAILED != addr) ? addr : NULL;
+#else
+  (void)size;
+  return NULL;
+#endif
+}
+
+/**
+ * @brief Maps the buffer aligned to the huge page and advises the kernel to back it by transparent huge pages.
+ */
+static void *map_advised(size_t size)
+{
+  uint8_t *addr =
+    (uint8_t *)mmap(NULL, size + MEM_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == (void *)addr)
+  {
+    return NULL;
+  }
+
+  // Huge pages can back only the ranges aligned to their size, so the unaligned ends are given back
+  uint8_t *aligned = (uint8_t *)align_up((uintptr_t)addr, MEM_HUGE_PAGE_SIZE);
+  size_t head = (size_t)(aligned - addr);
+
+  if (0 != head)
+  {
+    munmap(addr, head);
+  }
+  munmap(aligned + size, MEM_HUGE_PAGE_SIZE - head);
+
+#if defined(MADV_HUGEPAGE)
+  (void)madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+
+  return aligned;
+}
+
+/**
+ * @brief Binds the range to the NUMA node.
+ */
+static bool bind_node(void *addr, size_t size, int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+  unsigned long mask[MEM_MAX_NODES / MEM_ULONG_BITS] = {0};
+  mask[(unsigned)node / MEM_ULONG_BITS] = 1UL << ((unsigned)node % MEM_ULONG_BITS);
+
+  // The kernel takes the number of bits in the mask plus one
+
+  return 0 == syscall(SYS_mbind, addr, size, MEM_MPOL_BIND, mask, (unsigned long)MEM_MAX_NODES + 1, 0U);
+#else
+  (void)addr;
+  (void)size;
+  (void)node;
+  return false;
+#endif
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+#if MEM_PAGES_USE_MMAP
+/**
+ * @brief Maps the zeroed buffer of at least `size` bytes.
+ *
+ * Detailed description see in mem_pages.h
+ */
+void *mem_pages_alloc(size_t size, const mem_pages_opts_t *opts, size_t *mapped)
+{
+  static const mem_pages_opts_t default_opts = {.pages = MEM_PAGES_DEFAULT, .node = -1, .populate = false};
+
+  UC_ASSERT(0 != size);
+  UC_ASSERT(mapped);
+
+  if (NULL == opts)
+  {
+    opts = &default_opts;
+  }
+
+  UC_ASSERT(opts->pages <= MEM_PAGES_HUGE);
+  UC_ASSERT(opts->node < MEM_MAX_NODES);
+
+  if (size > SIZE_MAX - 2 * MEM_HUGE_PAGE_SIZE)
+  {
+    return NULL;
+  }
+
+  void *addr = NULL;
+
+  if (MEM_PAGES_DEFAULT == opts->pages)
+  {
+    size = align_up(size, page_size());
+    addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    addr = (MAP_FAILED != addr) ? addr : NULL;
+  }
+  else
+  {
+    size = align_up(size, MEM_HUGE_PAGE_SIZE);
+    addr = (MEM_PAGES_HUGE == opts->pages) ? map_huge(size) : NULL;
+    addr = (NULL != addr) ? addr : map_advised(size);
+  }
+
+  if (NULL == addr)
+  {
+    return NULL;
+  }
+
+  // The policy applies only to the pages which weren't touched yet
+  if (opts->node >= 0 && !bind_node(addr, size, opts->node))
+  {
+    munmap(addr, size);
+    return NULL;
+  }
+
+  if (opts->populate)
+  {
+    mem_pages_touch(addr, size);
+  }
+
+  *mapped = size;
+
+  return addr;
+}
+
+/**
+ * @brief Unmaps the buffer mapped by `mem_pages_alloc`.
+ *
+ * Detailed description see in mem_pages.h
+ */
+void mem_pages_free(void *addr, size_t mapped)
+{
+  if (NULL != addr)
+  {
+    munmap(addr, mapped);
+  }
+}
+
+/**
+ * @brief Returns the number of NUMA nodes which memory can be bound to.
+ *
+ * Detailed description see in mem_pages.h
+ */
+int mem_numa_nodes(void)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+  // The file lists the ranges of online nodes, e.g. "0-1" or "0,2"; the last number is the highest node
+  FILE *file = fopen("/sys/devices/system/node/online", "r");
+  if (NULL == file)
+  {
+    return 0;
+  }
+
+  int highest = -1;
+  int node;
+  char separator;
+
+  while (1 == fscanf(file, "%d", &node))
+  {
+    highest = node;
+    if (1 != fscanf(file, "%c", &separator))
+    {
+      break;
+    }
+  }
+  fclose(file);
+
+  return (highest < MEM_MAX_NODES) ? highest + 1 : MEM_MAX_NODES;
+#else
+  return 0;
+#endif
+}
+#else
+void *mem_pages_alloc(size_t size, const mem_pages_opts_t *opts, size_t *mapped)
+{
+  (void)size;
+  (void)opts;
+  (void)mapped;
+  return NULL;
+}
+
+void mem_pages_free(void *addr, size_t mapped)
+{
+  (void)addr;
+  (void)mapped;
+}
+
+int mem_numa_nodes(void)
+{
+  return 0;
+}
+#endif
+
+/**
+ * @brief Touches every page of the range.
+ *
+ * Detailed description see in mem_pages.h
+ */
+void mem_pages_touch(void *addr, size_t size)
+{
+  UC_ASSERT(addr || 0 == size);
+
+  // The smallest page size of supported platforms, touching more often is harmless
+  const size_t step = 4096;
+  volatile uint8_t *bytes = (volatile uint8_t *)addr;
+
+  for (size_t offset = 0; offset < size; offset += step)
+  {
+    bytes[offset] = bytes[offset];
+  }
+
+  if (0 != size)
+  {
+    bytes[size - 1] = bytes[size - 1];
+  }
+}
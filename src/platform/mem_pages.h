@@ -0,0 +1,85 @@
+/**
+ * @file    mem_pages.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Allocation of large buffers directly from the OS with control of page size and NUMA node.
+ * @date    2026-10-18
+ *
+ * Buffers of many megabytes allocated by the general purpose allocator are backed by 4 KiB pages and are
+ * placed on the NUMA node of the thread which touched them first. This module maps such buffers itself:
+ *
+ * - `MEM_PAGES_HUGE` maps explicit huge pages (`MAP_HUGETLB`) and falls back to transparent huge pages
+ *   if the pool of huge pages is empty; `MEM_PAGES_HUGE_ADVISE` only asks for transparent huge pages;
+ * - `node` binds the memory to the NUMA node by `mbind`;
+ * - `populate` touches every page during allocation. Without it the pages are placed on the first touch, so
+ *   the consumer thread can touch them by `mem_pages_touch` before the buffer is used.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Size of the huge page used for alignment and rounding of the buffers */
+#ifndef MEM_HUGE_PAGE_SIZE
+  #define MEM_HUGE_PAGE_SIZE (2U * 1024U * 1024U)
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief Kind of pages which back the buffer.
+ */
+typedef enum
+{
+  MEM_PAGES_DEFAULT = 0, /**< Pages of the default size */
+  MEM_PAGES_HUGE_ADVISE, /**< Transparent huge pages are advised by `madvise` */
+  MEM_PAGES_HUGE,        /**< Explicit huge pages, transparent huge pages if they are not available */
+} mem_pages_t;
+
+/**
+ * @brief Options of the allocation.
+ */
+typedef struct
+{
+  mem_pages_t pages; /**< Kind of pages */
+  int node;          /**< NUMA node to bind the memory to or -1 for the default policy */
+  bool populate;     /**< Touch every page during allocation */
+} mem_pages_opts_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Maps the zeroed buffer of at least `size` bytes.
+ *
+ * @param[in] size Size in bytes of the buffer.
+ * @param[in] opts Options of the allocation or NULL for the default ones.
+ * @param[out] mapped Size in bytes of the mapping which has to be passed to `mem_pages_free`.
+ * @return Pointer to the buffer or NULL if it can't be mapped or bound to the node.
+ */
+void *mem_pages_alloc(size_t size, const mem_pages_opts_t *opts, size_t *mapped);
+
+/**
+ * @brief Unmaps the buffer mapped by `mem_pages_alloc`.
+ *
+ * @param[in] addr Pointer to the buffer.
+ * @param[in] mapped Size returned by `mem_pages_alloc`.
+ */
+void mem_pages_free(void *addr, size_t mapped);
+
+/**
+ * @brief Touches every page of the range, so the pages which weren't touched yet are placed on the NUMA node
+ *        of the calling thread.
+ *
+ * The content of the range is not changed, but the range must not be modified concurrently.
+ *
+ * @param[in] addr Beginning of the range.
+ * @param[in] size Size in bytes of the range.
+ */
+void mem_pages_touch(void *addr, size_t size);
+
+/**
+ * @brief Returns the number of NUMA nodes which memory can be bound to.
+ *
+ * @return Number of nodes or 0 if binding is not supported.
+ */
+int mem_numa_nodes(void);
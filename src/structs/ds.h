@@ -9,14 +9,59 @@
 #pragma once
 
 //_____ I N C L U D E S _______________________________________________________
-#include "core/container.h"
+#include <stdbool.h>
+#include <stddef.h>
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
+typedef struct DataStructure_t ds_t;
+
+/**
+ * @brief Kinds of data structures, allow to recreate the data structure e.g. from its snapshot.
+ */
+typedef enum
+{
+  DS_KIND_STACK = 1,
+  DS_KIND_QUEUE,
+  DS_KIND_RING_BUFFER,
+  DS_KIND_QUEUE_MPSC, /**< Lock-free queue, which is saved into the snapshot as `DS_KIND_QUEUE` */
+} ds_kind_t;
+
+/**
+ * @brief Contiguous run of elements placed in the storage of data structure.
+ */
 typedef struct
 {
-  container_t *container; /**< Pointer to the universal container */
+  void *data;   /**< Pointer to the first element of the span */
+  size_t count; /**< Number of elements in the span */
+} ds_span_t;
+
+/**
+ * @brief Access to the storage of data structure which is implemented by every data structure.
+ */
+typedef struct
+{
+  /** Returns size in bytes of the single element */
+  size_t (*esize)(const ds_t *ds);
+
+  /**
+   * Returns the next contiguous span of elements in the storage order: from the element which would be retrieved
+   * first to the last one for the queue and the ring buffer, from the bottom to the top for the stack. `pos` is
+   * the opaque position which has to be NULL for the first call. Returns false if there are no more elements.
+   */
+  bool (*next_span)(const ds_t *ds, void **pos, ds_span_t *span);
+
+  /** Returns max number of elements which was passed to the constructor or 0 if the data structure is unlimited */
+  size_t (*capacity)(const ds_t *ds);
+
+  /** Kind of the data structure */
+  ds_kind_t kind;
+} ds_iface_t;
+
+struct DataStructure_t
+{
   void *meta; /**< Pointer to the private structure which contain meta data specific for current data structure */
-} ds_t;
+  const ds_iface_t *iface; /**< Access to the storage of the data structure */
+};
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P U B L I C  F U N C T I O N S_________________________________________
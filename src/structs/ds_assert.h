@@ -0,0 +1,47 @@
+/**
+ * @file    ds_assert.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Compile time selectable levels of argument checking for data structures.
+ * @date    2026-10-18
+ *
+ * The checks of `create`/`delete` functions always use `UC_ASSERT` directly. The per-element functions
+ * (push/pop/add/get/peek etc.) use the macros from this file so that their checks can be compiled out:
+ *
+ * - `DS_ASSERT_LEVEL_OFF`      - no checks in per-element functions;
+ * - `DS_ASSERT_LEVEL_CHEAP`    - only checks of the arguments passed by user;
+ * - `DS_ASSERT_LEVEL_PARANOID` - also checks of the internal state of the data structure.
+ *
+ * The level is selected by defining `DS_ASSERT_LEVEL` in the build flags, e.g. `-DDS_ASSERT_LEVEL=0`.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include "common/uc_assert.h"
+//_____ C O N F I G S  ________________________________________________________
+#define DS_ASSERT_LEVEL_OFF      0
+#define DS_ASSERT_LEVEL_CHEAP    1
+#define DS_ASSERT_LEVEL_PARANOID 2
+
+#ifndef DS_ASSERT_LEVEL
+  #ifdef NDEBUG
+    #define DS_ASSERT_LEVEL DS_ASSERT_LEVEL_OFF
+  #else
+    #define DS_ASSERT_LEVEL DS_ASSERT_LEVEL_PARANOID
+  #endif
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+#if DS_ASSERT_LEVEL >= DS_ASSERT_LEVEL_CHEAP
+  #define DS_ASSERT_CHEAP(expr) UC_ASSERT(expr)
+#else
+  #define DS_ASSERT_CHEAP(expr) ((void)0)
+#endif
+
+#if DS_ASSERT_LEVEL >= DS_ASSERT_LEVEL_PARANOID
+  #define DS_ASSERT_PARANOID(expr) UC_ASSERT(expr)
+#else
+  #define DS_ASSERT_PARANOID(expr) ((void)0)
+#endif
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
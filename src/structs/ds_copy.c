@@ -0,0 +1,128 @@
+/**
+ * @file    ds_copy.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Element copy kernels selected by the size of element.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ds_copy.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform/cpu_dispatch.h"
+//_____ C O N F I G S  ________________________________________________________
+#if DS_COPY_USE_SIMD && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  #define DS_COPY_SIMD_X86 1
+  #include <immintrin.h>
+#else
+  #define DS_COPY_SIMD_X86 0
+#endif
+
+/** Max size in bytes of the element copied by AVX2 moves: `memcpy` is faster for larger blocks */
+#define DS_COPY_AVX2_MAX 1024U
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+/** Defines the kernel which copies `SIZE` bytes known at compile time */
+#define FIXED_COPY(NAME, SIZE)                                  \
+  static void NAME(void *dst, const void *src, size_t size)     \
+  {                                                             \
+    (void)size;                                                 \
+    memcpy(dst, src, SIZE);                                     \
+  }
+
+#if DS_COPY_SIMD_X86
+  #define AVX2 __attribute__((target("avx2")))
+#endif
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+FIXED_COPY(copy_1, 1)
+FIXED_COPY(copy_2, 2)
+FIXED_COPY(copy_4, 4)
+FIXED_COPY(copy_8, 8)
+FIXED_COPY(copy_16, 16)
+FIXED_COPY(copy_32, 32)
+FIXED_COPY(copy_64, 64)
+
+static void copy_generic(void *dst, const void *src, size_t size)
+{
+  memcpy(dst, src, size);
+}
+
+#if DS_COPY_SIMD_X86
+/**
+ * @brief Copies the element which size is a multiple of 32 bytes.
+ */
+AVX2 static void copy_avx2(void *dst, const void *src, size_t size)
+{
+  uint8_t *d = (uint8_t *)dst;
+  const uint8_t *s = (const uint8_t *)src;
+
+  for (size_t i = 0; i < size; i += 32)
+  {
+    _mm256_storeu_si256((__m256i *)(d + i), _mm256_loadu_si256((const __m256i *)(s + i)));
+  }
+}
+
+/**
+ * @brief Copies the huge element by non-temporal stores to the aligned destination.
+ */
+AVX2 static void copy_stream_avx2(void *dst, const void *src, size_t size)
+{
+  uint8_t *d = (uint8_t *)dst;
+  const uint8_t *s = (const uint8_t *)src;
+
+  size_t head = (32 - ((uintptr_t)d & 31)) & 31;
+  memcpy(d, s, head);
+
+  size_t i = head;
+  for (; i + 32 <= size; i += 32)
+  {
+    _mm256_stream_si256((__m256i *)(d + i), _mm256_loadu_si256((const __m256i *)(s + i)));
+  }
+
+  memcpy(d + i, s + i, size - i);
+
+  // Non-temporal stores are weakly ordered: make them visible before the element is published
+  _mm_sfence();
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Returns the best copy kernel for the element of `esize` bytes.
+ *
+ * Detailed description see in ds_copy.h
+ */
+ds_copy_fn_t ds_copy_select(size_t esize)
+{
+  switch (esize)
+  {
+    case 1: return copy_1;
+    case 2: return copy_2;
+    case 4: return copy_4;
+    case 8: return copy_8;
+    case 16: return copy_16;
+    case 32: return copy_32;
+    case 64: return copy_64;
+    default: break;
+  }
+
+#if DS_COPY_SIMD_X86
+  if (cpu_has(CPU_FEATURE_AVX2))
+  {
+    if (esize >= DS_COPY_STREAM_THRESHOLD)
+    {
+      return copy_stream_avx2;
+    }
+
+    if (0 == esize % 32 && esize <= DS_COPY_AVX2_MAX)
+    {
+      return copy_avx2;
+    }
+  }
+#endif
+
+  return copy_generic;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file    ds_copy.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Element copy kernels selected by the size of element.
+ * @date    2026-10-18
+ *
+ * Data structures select the kernel once at creation time and keep it in their meta, so every
+ * push/pop/add/get copies the element by the routine specialized for its size instead of the `memcpy`
+ * with the length known only at runtime:
+ *
+ * - 1/2/4/8/16/32/64 bytes                 - fixed size moves;
+ * - multiples of 32 bytes up to 1 KiB        - AVX2 moves if they are supported by the CPU;
+ * - `DS_COPY_STREAM_THRESHOLD` bytes or more - AVX2 non-temporal stores which don't pollute the cache;
+ * - any other size                           - `memcpy`.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stddef.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 to build the copy kernels without SIMD instructions */
+#ifndef DS_COPY_USE_SIMD
+  #define DS_COPY_USE_SIMD 1
+#endif
+
+/** Min size in bytes of the element which is copied by non-temporal stores */
+#ifndef DS_COPY_STREAM_THRESHOLD
+  #define DS_COPY_STREAM_THRESHOLD (256U * 1024U)
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief Copies the element of `size` bytes. The kernels for fixed sizes ignore `size`.
+ */
+typedef void (*ds_copy_fn_t)(void *dst, const void *src, size_t size);
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Returns the best copy kernel for the element of `esize` bytes.
+ *
+ * @param[in] esize The size in bytes of the single element.
+ * @return The copy kernel which has to be called with `size` equal to `esize`.
+ */
+ds_copy_fn_t ds_copy_select(size_t esize);
@@ -0,0 +1,98 @@
+/**
+ * @file    ds_cursor.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Cursor for sequential access to the elements of any data structure which supports `ds_t` interface.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ds_cursor.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "structs/ds_assert.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Loads the next non-empty span of the data structure into the cursor.
+ */
+static bool load_span(ds_cursor_t *cursor)
+{
+  while (0 == cursor->span.count)
+  {
+    if (!cursor->ds->iface->next_span(cursor->ds, &cursor->pos, &cursor->span))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Initializes the cursor.
+ *
+ * Detailed description see in ds_cursor.h
+ */
+void ds_cursor_init(ds_cursor_t *cursor, const ds_t *ds)
+{
+  UC_ASSERT(cursor);
+  UC_ASSERT(ds);
+  UC_ASSERT(ds->iface);
+
+  cursor->ds = ds;
+  cursor->pos = NULL;
+  cursor->span.data = NULL;
+  cursor->span.count = 0;
+  cursor->esize = ds->iface->esize(ds);
+}
+
+/**
+ * @brief Moves the cursor to the next element.
+ *
+ * Detailed description see in ds_cursor.h
+ */
+void *ds_cursor_next(ds_cursor_t *cursor)
+{
+  DS_ASSERT_CHEAP(cursor);
+  DS_ASSERT_PARANOID(cursor->ds);
+
+  if (!load_span(cursor))
+  {
+    return NULL;
+  }
+
+  void *element = cursor->span.data;
+  cursor->span.data = (uint8_t *)cursor->span.data + cursor->esize;
+  cursor->span.count--;
+
+  return element;
+}
+
+/**
+ * @brief Returns the rest of the current span.
+ *
+ * Detailed description see in ds_cursor.h
+ */
+bool ds_cursor_next_span(ds_cursor_t *cursor, ds_span_t *span)
+{
+  DS_ASSERT_CHEAP(cursor);
+  DS_ASSERT_CHEAP(span);
+  DS_ASSERT_PARANOID(cursor->ds);
+
+  if (!load_span(cursor))
+  {
+    return false;
+  }
+
+  *span = cursor->span;
+  cursor->span.count = 0;
+
+  return true;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file    ds_cursor.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Cursor for sequential access to the elements of any data structure which supports `ds_t` interface.
+ * @date    2026-10-18
+ *
+ * The cursor walks the storage of data structure natively (by nodes for lists, by contiguous spans for arrays)
+ * so the full scan takes O(n) for every data structure. Elements are not copied: the cursor hands out pointers
+ * to the elements placed in the storage of data structure.
+ *
+ * The cursor is invalidated by any function which changes the data structure.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "structs/ds.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  const ds_t *ds;  /**< Data structure which is walked by the cursor */
+  void *pos;       /**< Opaque position of the current span in the storage */
+  ds_span_t span;  /**< Not yet visited part of the current span */
+  size_t esize;    /**< Size in bytes of the single element */
+} ds_cursor_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Initializes the cursor which points before the first element of the data structure.
+ *
+ * @param[out] cursor Pointer to the cursor.
+ * @param[in] ds Pointer to the data structure.
+ */
+void ds_cursor_init(ds_cursor_t *cursor, const ds_t *ds);
+
+/**
+ * @brief Moves the cursor to the next element and returns pointer to it.
+ *
+ * @param[in] cursor Pointer to the cursor.
+ * @return Pointer to the element or NULL if all elements were visited.
+ */
+void *ds_cursor_next(ds_cursor_t *cursor);
+
+/**
+ * @brief Returns all not yet visited elements of the current contiguous span and moves the cursor past them.
+ *
+ * Allows to process the elements by blocks instead of one by one.
+ *
+ * @param[in] cursor Pointer to the cursor.
+ * @param[out] span Pointer to the span.
+ * @return true if the span was returned, false if all elements were visited.
+ */
+bool ds_cursor_next_span(ds_cursor_t *cursor, ds_span_t *span);
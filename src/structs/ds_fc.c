@@ -0,0 +1,336 @@
+/**
+ * @file    ds_fc.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Flat combining access to the stack and the queue from several threads.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ds_fc.h"
+
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_assert.h"
+#include "structs/ds_copy.h"
+#include "structs/queue/queue.h"
+#include "structs/stack/stack.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 if the platform has no `sched_yield`, the waiting threads then only spin */
+#ifndef DS_FC_USE_YIELD
+  #if defined(__unix__) || defined(__APPLE__)
+    #define DS_FC_USE_YIELD 1
+  #else
+    #define DS_FC_USE_YIELD 0
+  #endif
+#endif
+
+/** Number of checks of the slot after which the waiting thread yields the processor */
+#ifndef DS_FC_SPIN_LIMIT
+  #define DS_FC_SPIN_LIMIT 64U
+#endif
+
+#if DS_FC_USE_YIELD
+  #include <sched.h>
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief States of the slot of the publication array.
+ */
+enum
+{
+  SLOT_FREE = 0, /**< Nobody uses the slot */
+  SLOT_CLAIMED,  /**< The thread fills the request */
+  SLOT_PUT,      /**< Request to put the element */
+  SLOT_TAKE,     /**< Request to take the element */
+  SLOT_DONE,     /**< Request is served successfully */
+  SLOT_FAILED,   /**< Request is served unsuccessfully */
+};
+
+/**
+ * @brief Slot of the publication array occupying its own cache line.
+ */
+typedef struct
+{
+  _Alignas(DS_FC_CACHE_LINE) atomic_uint state; /**< State of the slot */
+  const void *in;                               /**< Element of the put request */
+  void *out;                                    /**< Destination of the take request */
+} fc_slot_t;
+
+struct DsFc_t
+{
+  atomic_bool lock;         /**< Lock of the combiner */
+  ds_t *ds;                 /**< Wrapped data structure */
+  size_t esize;             /**< Size in bytes of the single element */
+  ds_copy_fn_t copy;        /**< Copy kernel for the size of element */
+  atomic_size_t eliminated; /**< Number of eliminated pairs of requests */
+  fc_slot_t *slots; /**< Publication array of `DS_FC_SLOTS` placed in the same memory block at the cache line */
+};
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+/** Number of threads which used any wrapper */
+static atomic_uint threads = 0;
+
+/** Slot which the calling thread tries first or UINT_MAX if it isn't assigned yet */
+static _Thread_local unsigned home = UINT_MAX;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Yields the processor after `DS_FC_SPIN_LIMIT` spins of the waiting thread.
+ */
+static void backoff(unsigned spins)
+{
+#if DS_FC_USE_YIELD
+  if (spins >= DS_FC_SPIN_LIMIT)
+  {
+    sched_yield();
+  }
+#else
+  (void)spins;
+#endif
+}
+
+/**
+ * @brief Takes the free slot, starting from the home slot of the calling thread.
+ */
+static fc_slot_t *claim(ds_fc_t *fc)
+{
+  if (UINT_MAX == home)
+  {
+    home = atomic_fetch_add_explicit(&threads, 1, memory_order_relaxed);
+  }
+
+  for (unsigned i = 0;; i++)
+  {
+    fc_slot_t *slot = &fc->slots[(home + i) % DS_FC_SLOTS];
+    unsigned state = SLOT_FREE;
+
+    if (SLOT_FREE == atomic_load_explicit(&slot->state, memory_order_relaxed) &&
+        atomic_compare_exchange_strong_explicit(&slot->state, &state, SLOT_CLAIMED, memory_order_acquire,
+                                                memory_order_relaxed))
+    {
+      return slot;
+    }
+
+    backoff(i / DS_FC_SLOTS);
+  }
+}
+
+/**
+ * @brief Marks the request of the slot as served and wakes its thread.
+ */
+static void finish(fc_slot_t *slot, bool status)
+{
+  atomic_store_explicit(&slot->state, status ? SLOT_DONE : SLOT_FAILED, memory_order_release);
+}
+
+/**
+ * @brief Checks if the pairs of put and take requests may be eliminated in the current state.
+ */
+static bool can_eliminate(const ds_t *ds)
+{
+  return (DS_KIND_STACK == ds->iface->kind) ? !stack_full(ds) : queue_empty(ds);
+}
+
+/**
+ * @brief Serves the requests of all slots. The lock of the combiner has to be held.
+ */
+static void combine(ds_fc_t *fc)
+{
+  fc_slot_t *puts[DS_FC_SLOTS];
+  fc_slot_t *takes[DS_FC_SLOTS];
+  size_t nputs = 0;
+  size_t ntakes = 0;
+
+  for (size_t i = 0; i < DS_FC_SLOTS; i++)
+  {
+    unsigned state = atomic_load_explicit(&fc->slots[i].state, memory_order_acquire);
+    if (SLOT_PUT == state)
+    {
+      puts[nputs++] = &fc->slots[i];
+    }
+    else if (SLOT_TAKE == state)
+    {
+      takes[ntakes++] = &fc->slots[i];
+    }
+  }
+
+  size_t pairs = 0;
+  if (can_eliminate(fc->ds))
+  {
+    pairs = (nputs < ntakes) ? nputs : ntakes;
+    for (size_t i = 0; i < pairs; i++)
+    {
+      fc->copy(takes[i]->out, puts[i]->in, fc->esize);
+      finish(puts[i], true);
+      finish(takes[i], true);
+    }
+    atomic_fetch_add_explicit(&fc->eliminated, pairs, memory_order_relaxed);
+  }
+
+  bool stack = DS_KIND_STACK == fc->ds->iface->kind;
+  for (size_t i = pairs; i < nputs; i++)
+  {
+    finish(puts[i], stack ? stack_push(fc->ds, puts[i]->in) : queue_add(fc->ds, puts[i]->in));
+  }
+  for (size_t i = pairs; i < ntakes; i++)
+  {
+    finish(takes[i], stack ? stack_pop(fc->ds, takes[i]->out) : queue_get(fc->ds, takes[i]->out));
+  }
+}
+
+/**
+ * @brief Publishes the request and waits until it is served, combining the requests of others meanwhile.
+ */
+static bool request(ds_fc_t *fc, unsigned op, const void *in, void *out)
+{
+  fc_slot_t *slot = claim(fc);
+  slot->in = in;
+  slot->out = out;
+  atomic_store_explicit(&slot->state, op, memory_order_release);
+
+  for (unsigned spins = 0;; spins++)
+  {
+    unsigned state = atomic_load_explicit(&slot->state, memory_order_acquire);
+    if (SLOT_DONE == state || SLOT_FAILED == state)
+    {
+      atomic_store_explicit(&slot->state, SLOT_FREE, memory_order_release);
+      return SLOT_DONE == state;
+    }
+
+    if (!atomic_load_explicit(&fc->lock, memory_order_relaxed) &&
+        !atomic_exchange_explicit(&fc->lock, true, memory_order_acquire))
+    {
+      combine(fc);
+      atomic_store_explicit(&fc->lock, false, memory_order_release);
+      continue;
+    }
+
+    backoff(spins);
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the flat combining wrapper.
+ *
+ * Detailed description see in ds_fc.h
+ */
+ds_fc_t *ds_fc_create(ds_t *ds)
+{
+  if (NULL == ds || !is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  UC_ASSERT(ds->iface);
+
+  if (DS_KIND_STACK != ds->iface->kind && DS_KIND_QUEUE != ds->iface->kind)
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  // The allocator gives no alignment to the cache line, so the slots are shifted to the boundary inside the block
+  ds_fc_t *fc = (ds_fc_t *)mem_allocate(sizeof(ds_fc_t) + DS_FC_CACHE_LINE - 1 + DS_FC_SLOTS * sizeof(fc_slot_t));
+  if (NULL == fc)
+  {
+    return NULL;
+  }
+
+  uintptr_t slots = (uintptr_t)fc + sizeof(ds_fc_t);
+  fc->slots = (fc_slot_t *)((slots + DS_FC_CACHE_LINE - 1) & ~(uintptr_t)(DS_FC_CACHE_LINE - 1));
+
+  atomic_init(&fc->lock, false);
+  fc->ds = ds;
+  fc->esize = ds->iface->esize(ds);
+  fc->copy = ds_copy_select(fc->esize);
+  atomic_init(&fc->eliminated, 0);
+  for (size_t i = 0; i < DS_FC_SLOTS; i++)
+  {
+    atomic_init(&fc->slots[i].state, SLOT_FREE);
+    fc->slots[i].in = NULL;
+    fc->slots[i].out = NULL;
+  }
+
+  return fc;
+}
+
+/**
+ * @brief Deletes the wrapper together with the data structure.
+ *
+ * Detailed description see in ds_fc.h
+ */
+void ds_fc_delete(ds_fc_t **fc)
+{
+  UC_ASSERT(fc);
+  UC_ASSERT(*fc);
+
+  ds_t *ds = (*fc)->ds;
+  if (DS_KIND_STACK == ds->iface->kind)
+  {
+    stack_delete(&ds);
+  }
+  else
+  {
+    queue_delete(&ds);
+  }
+
+  free_fn_t mem_free = get_free();
+  mem_free(*fc);
+  *fc = NULL;
+}
+
+/**
+ * @brief Returns the wrapped data structure.
+ *
+ * Detailed description see in ds_fc.h
+ */
+ds_t *ds_fc_ds(const ds_fc_t *fc)
+{
+  DS_ASSERT_CHEAP(fc);
+
+  return fc->ds;
+}
+
+/**
+ * @brief Pushes or adds the element.
+ *
+ * Detailed description see in ds_fc.h
+ */
+bool ds_fc_put(ds_fc_t *fc, const void *data)
+{
+  DS_ASSERT_CHEAP(fc);
+  DS_ASSERT_CHEAP(data);
+
+  return request(fc, SLOT_PUT, data, NULL);
+}
+
+/**
+ * @brief Pops or retrieves the element.
+ *
+ * Detailed description see in ds_fc.h
+ */
+bool ds_fc_take(ds_fc_t *fc, void *data)
+{
+  DS_ASSERT_CHEAP(fc);
+  DS_ASSERT_CHEAP(data);
+
+  return request(fc, SLOT_TAKE, NULL, data);
+}
+
+/**
+ * @brief Returns the number of eliminated pairs of requests.
+ *
+ * Detailed description see in ds_fc.h
+ */
+size_t ds_fc_eliminated(const ds_fc_t *fc)
+{
+  DS_ASSERT_CHEAP(fc);
+
+  return atomic_load_explicit(&fc->eliminated, memory_order_relaxed);
+}
@@ -0,0 +1,93 @@
+/**
+ * @file    ds_fc.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Flat combining access to the stack and the queue from several threads.
+ * @date    2026-10-18
+ *
+ * The thread doesn't apply its operation itself: it publishes the request in the slot of the publication array
+ * and either waits until the request is served or, if nobody does it, becomes the combiner. The combiner takes
+ * the lock once, serves the requests of all slots by the ordinary sequential `stack_t` or `queue_t` and releases
+ * the lock, so the data structure and the lock stay in the cache of one core during the whole batch and the
+ * waiting threads spin on their own slots only.
+ *
+ * Before applying the batch the combiner eliminates the pairs of put and take requests: the element of the put is
+ * copied directly to the take. The pairs are eliminated for the stack which isn't full and for the queue which is
+ * empty, in both cases the result is the same as if the put were applied right before the take.
+ *
+ * The elements are passed by pointers to the memory of the waiting threads, so neither the slots nor the
+ * combiner copy them more than the sequential data structure does.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "structs/ds.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Number of slots of the publication array, more threads share the slots */
+#ifndef DS_FC_SLOTS
+  #define DS_FC_SLOTS 32U
+#endif
+
+/** Size of the cache line which separates the slots */
+#ifndef DS_FC_CACHE_LINE
+  #define DS_FC_CACHE_LINE 64U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct DsFc_t ds_fc_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the flat combining wrapper which takes the ownership of the stack or the queue.
+ *
+ * @param[in] ds Pointer to the stack or the queue created by `stack_create` or `queue_create`. NULL is passed
+ *               through, so the result of the constructor can be wrapped directly.
+ * @return Pointer to the wrapper or NULL if `ds` is NULL, isn't the stack or the queue or there is no memory. The
+ *         data structure isn't deleted on failure.
+ */
+ds_fc_t *ds_fc_create(ds_t *ds);
+
+/**
+ * @brief Deletes the wrapper together with the data structure. There must be no other threads using it.
+ *
+ * @param[in] fc Double pointer to the wrapper.
+ */
+void ds_fc_delete(ds_fc_t **fc);
+
+/**
+ * @brief Returns the wrapped data structure which may be used only while no thread uses the wrapper.
+ *
+ * @param[in] fc Pointer to the wrapper.
+ * @return Pointer to the data structure.
+ */
+ds_t *ds_fc_ds(const ds_fc_t *fc);
+
+/**
+ * @brief Pushes the element to the stack or adds it to the queue.
+ *
+ * @param[in] fc Pointer to the wrapper.
+ * @param[in] data Pointer to the element.
+ * @return true if the operation was successful, false otherwise.
+ */
+bool ds_fc_put(ds_fc_t *fc, const void *data);
+
+/**
+ * @brief Pops the element from the stack or retrieves it from the queue.
+ *
+ * @param[in] fc Pointer to the wrapper.
+ * @param[out] data Pointer to a variable where the element will be stored.
+ * @return true if the operation was successful, false if the data structure is empty.
+ */
+bool ds_fc_take(ds_fc_t *fc, void *data);
+
+/**
+ * @brief Returns the number of pairs of requests eliminated by the combiners, for statistics.
+ *
+ * @param[in] fc Pointer to the wrapper.
+ * @return Number of eliminated pairs.
+ */
+size_t ds_fc_eliminated(const ds_fc_t *fc);
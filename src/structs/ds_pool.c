@@ -0,0 +1,261 @@
+/**
+ * @file    ds_pool.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Lock-free pool of fixed-size nodes for concurrent data structures.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ds_pool.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_assert.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief Header placed before the payload of every node.
+ */
+typedef struct
+{
+  atomic_uint next; /**< Index of the next free node */
+  uint32_t index;   /**< Index of this node */
+} pool_header_t;
+
+struct DsPool_t
+{
+  atomic_uint_fast64_t top;                    /**< Index of the first free node in low half, tag in high half */
+  size_t stride;                               /**< Size in bytes of the node with the header */
+  size_t slab;                                 /**< Number of nodes in the slab */
+  atomic_size_t slabs;                         /**< Number of claimed entries of `table` */
+  _Atomic(uint8_t *) table[DS_POOL_MAX_SLABS]; /**< Slabs of nodes */
+};
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Returns the header of the node by its index.
+ */
+static pool_header_t *node_at(const ds_pool_t *pool, uint32_t index)
+{
+  uint8_t *slab = atomic_load_explicit(&pool->table[index / pool->slab], memory_order_acquire);
+  return (pool_header_t *)(slab + (index % pool->slab) * pool->stride);
+}
+
+/**
+ * @brief Pushes the chain of nodes linked from `first` to `last` to the list of free nodes.
+ */
+static void push_chain(ds_pool_t *pool, pool_header_t *first, pool_header_t *last)
+{
+  uint_fast64_t top = atomic_load_explicit(&pool->top, memory_order_relaxed);
+  uint_fast64_t next;
+
+  do
+  {
+    atomic_store_explicit(&last->next, (uint32_t)(top & UINT32_MAX), memory_order_relaxed);
+    next = ((top >> 32) + 1) << 32 | first->index;
+  } while (!atomic_compare_exchange_weak_explicit(&pool->top, &top, next, memory_order_release,
+                                                  memory_order_relaxed));
+}
+
+/**
+ * @brief Allocates the new slab, keeps its first node and frees the rest.
+ *
+ * @return Header of the first node or NULL.
+ */
+static pool_header_t *grow(ds_pool_t *pool)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  uint8_t *slab = (uint8_t *)mem_allocate(pool->slab * pool->stride);
+  if (NULL == slab)
+  {
+    return NULL;
+  }
+
+  size_t number = atomic_fetch_add_explicit(&pool->slabs, 1, memory_order_relaxed);
+  if (number >= DS_POOL_MAX_SLABS)
+  {
+    atomic_fetch_sub_explicit(&pool->slabs, 1, memory_order_relaxed);
+    mem_free(slab);
+    return NULL;
+  }
+
+  uint32_t base = (uint32_t)(number * pool->slab);
+  for (size_t i = 0; i < pool->slab; i++)
+  {
+    pool_header_t *header = (pool_header_t *)(slab + i * pool->stride);
+    header->index = base + (uint32_t)i;
+    atomic_init(&header->next, base + (uint32_t)i + 1);
+  }
+
+  // The slab has to be visible before its indexes are published in the list
+  atomic_store_explicit(&pool->table[number], slab, memory_order_release);
+
+  if (pool->slab > 1)
+  {
+    pool_header_t *last = (pool_header_t *)(slab + (pool->slab - 1) * pool->stride);
+    push_chain(pool, (pool_header_t *)(slab + pool->stride), last);
+  }
+
+  return (pool_header_t *)slab;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the empty pool.
+ *
+ * Detailed description see in ds_pool.h
+ */
+ds_pool_t *ds_pool_create(size_t size, size_t slab)
+{
+  UC_ASSERT(0 != slab);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  // All indexes of the nodes have to fit into 32 bits
+  if (slab > (DS_POOL_NIL - 1) / DS_POOL_MAX_SLABS || size > SIZE_MAX / 2)
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  ds_pool_t *pool = (ds_pool_t *)mem_allocate(sizeof(ds_pool_t));
+  if (NULL == pool)
+  {
+    return NULL;
+  }
+
+  atomic_init(&pool->top, DS_POOL_NIL);
+  pool->stride = sizeof(pool_header_t) + (size + 7U) / 8U * 8U;
+  pool->slab = slab;
+  atomic_init(&pool->slabs, 0);
+  for (size_t i = 0; i < DS_POOL_MAX_SLABS; i++)
+  {
+    atomic_init(&pool->table[i], NULL);
+  }
+
+  return pool;
+}
+
+/**
+ * @brief Frees up all slabs of the pool.
+ *
+ * Detailed description see in ds_pool.h
+ */
+void ds_pool_delete(ds_pool_t **pool)
+{
+  UC_ASSERT(pool);
+  UC_ASSERT(*pool);
+
+  free_fn_t mem_free = get_free();
+
+  size_t slabs = atomic_load_explicit(&(*pool)->slabs, memory_order_acquire);
+  for (size_t i = 0; i < slabs && i < DS_POOL_MAX_SLABS; i++)
+  {
+    uint8_t *slab = atomic_load_explicit(&(*pool)->table[i], memory_order_relaxed);
+    if (NULL != slab)
+    {
+      mem_free(slab);
+    }
+  }
+
+  mem_free(*pool);
+  *pool = NULL;
+}
+
+/**
+ * @brief Takes the node from the pool.
+ *
+ * Detailed description see in ds_pool.h
+ */
+void *ds_pool_alloc(ds_pool_t *pool)
+{
+  DS_ASSERT_CHEAP(pool);
+
+  uint_fast64_t top = atomic_load_explicit(&pool->top, memory_order_acquire);
+
+  for (;;)
+  {
+    uint32_t index = (uint32_t)(top & UINT32_MAX);
+    if (DS_POOL_NIL == index)
+    {
+      pool_header_t *header = grow(pool);
+      return (NULL != header) ? (void *)(header + 1) : NULL;
+    }
+
+    // The node may be taken by another thread meanwhile, but its memory stays valid and the tag detects it
+    pool_header_t *header = node_at(pool, index);
+    uint32_t next = atomic_load_explicit(&header->next, memory_order_relaxed);
+    uint_fast64_t desired = ((top >> 32) + 1) << 32 | next;
+
+    if (atomic_compare_exchange_weak_explicit(&pool->top, &top, desired, memory_order_acquire,
+                                              memory_order_acquire))
+    {
+      return header + 1;
+    }
+  }
+}
+
+/**
+ * @brief Returns the node to the pool.
+ *
+ * Detailed description see in ds_pool.h
+ */
+void ds_pool_free(ds_pool_t *pool, void *node)
+{
+  DS_ASSERT_CHEAP(pool);
+  DS_ASSERT_CHEAP(node);
+
+  pool_header_t *header = (pool_header_t *)node - 1;
+  push_chain(pool, header, header);
+}
+
+/**
+ * @brief Returns the index of the node.
+ *
+ * Detailed description see in ds_pool.h
+ */
+uint32_t ds_pool_index(const ds_pool_t *pool, const void *node)
+{
+  (void)pool;
+  DS_ASSERT_CHEAP(pool);
+  DS_ASSERT_CHEAP(node);
+
+  return ((const pool_header_t *)node - 1)->index;
+}
+
+/**
+ * @brief Returns the node by its index.
+ *
+ * Detailed description see in ds_pool.h
+ */
+void *ds_pool_node(const ds_pool_t *pool, uint32_t index)
+{
+  DS_ASSERT_CHEAP(pool);
+  DS_ASSERT_CHEAP(DS_POOL_NIL != index);
+
+  return node_at(pool, index) + 1;
+}
+
+/**
+ * @brief Returns the number of nodes allocated by all slabs.
+ *
+ * Detailed description see in ds_pool.h
+ */
+size_t ds_pool_capacity(const ds_pool_t *pool)
+{
+  DS_ASSERT_CHEAP(pool);
+
+  size_t slabs = atomic_load_explicit(&pool->slabs, memory_order_relaxed);
+  return ((slabs < DS_POOL_MAX_SLABS) ? slabs : DS_POOL_MAX_SLABS) * pool->slab;
+}
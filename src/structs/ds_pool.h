@@ -0,0 +1,93 @@
+/**
+ * @file    ds_pool.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Lock-free pool of fixed-size nodes for concurrent data structures.
+ * @date    2026-10-18
+ *
+ * The nodes are allocated through `allocator_if` by slabs of `slab` nodes and are never returned to the
+ * allocator until the pool is deleted, so a thread may safely read the node which was already freed by another
+ * thread. The freed nodes are kept in the lock-free stack whose top is the 32-bit index of the node tagged by
+ * the 32-bit counter of changes, so the stale top is detected by the single-width CAS (ABA protection).
+ *
+ * In the steady state `ds_pool_alloc` and `ds_pool_free` don't call the allocator at all. The payload of the node
+ * is aligned to 8 bytes.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Max number of slabs of the pool */
+#ifndef DS_POOL_MAX_SLABS
+  #define DS_POOL_MAX_SLABS 4096U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/** Index which doesn't refer to any node */
+#define DS_POOL_NIL UINT32_MAX
+
+typedef struct DsPool_t ds_pool_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the empty pool.
+ *
+ * @param[in] size Size in bytes of the payload of the node.
+ * @param[in] slab Number of nodes allocated at once when the pool is exhausted.
+ * @return Pointer to the pool or NULL if there is no memory.
+ */
+ds_pool_t *ds_pool_create(size_t size, size_t slab);
+
+/**
+ * @brief Frees up all slabs of the pool, including the nodes which weren't returned.
+ *
+ * @param[in] pool Double pointer to the pool.
+ */
+void ds_pool_delete(ds_pool_t **pool);
+
+/**
+ * @brief Takes the node from the pool, allocating the new slab if the pool is exhausted. Thread safe.
+ *
+ * @param[in] pool Pointer to the pool.
+ * @return Pointer to the payload of the node or NULL if there is no memory.
+ */
+void *ds_pool_alloc(ds_pool_t *pool);
+
+/**
+ * @brief Returns the node to the pool. Thread safe.
+ *
+ * @param[in] pool Pointer to the pool.
+ * @param[in] node Pointer to the payload returned by `ds_pool_alloc`.
+ */
+void ds_pool_free(ds_pool_t *pool, void *node);
+
+/**
+ * @brief Returns the index of the node which is unique within the pool and fits into 32 bits.
+ *
+ * The lock-free structures may store the index tagged by the counter instead of the pointer to the node.
+ *
+ * @param[in] pool Pointer to the pool.
+ * @param[in] node Pointer to the payload returned by `ds_pool_alloc`.
+ * @return Index of the node.
+ */
+uint32_t ds_pool_index(const ds_pool_t *pool, const void *node);
+
+/**
+ * @brief Returns the node by its index. The node stays readable even if it was freed meanwhile.
+ *
+ * @param[in] pool Pointer to the pool.
+ * @param[in] index Index returned by `ds_pool_index`.
+ * @return Pointer to the payload of the node.
+ */
+void *ds_pool_node(const ds_pool_t *pool, uint32_t index);
+
+/**
+ * @brief Returns the number of nodes allocated by all slabs.
+ *
+ * @param[in] pool Pointer to the pool.
+ * @return Number of nodes.
+ */
+size_t ds_pool_capacity(const ds_pool_t *pool);
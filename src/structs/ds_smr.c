@@ -0,0 +1,441 @@
+/**
+ * @file    ds_smr.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Safe memory reclamation for the lock-free data structures.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ds_smr.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_assert.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief Retired node with the global epoch at the moment of its retirement.
+ */
+typedef struct
+{
+  void *node;     /**< Pointer to the node */
+  uint64_t epoch; /**< Global epoch when the node was retired */
+} smr_retired_t;
+
+struct DsSmrThread_t
+{
+  atomic_uint_fast64_t epoch;              /**< Observed global epoch shifted by one, the low bit is set inside */
+  _Atomic(void *) hazards[DS_SMR_HAZARDS]; /**< Hazard pointers */
+  atomic_bool used;                        /**< Record is taken by the registered thread */
+  struct DsSmrThread_t *next;              /**< Next record of the domain, immutable after publishing */
+  ds_smr_t *smr;                           /**< Domain of the record */
+  smr_retired_t *retired;                  /**< Retired nodes which aren't reclaimed yet */
+  size_t count;                            /**< Number of retired nodes */
+  size_t allocated;                        /**< Capacity of `retired` */
+};
+
+struct DsSmr_t
+{
+  ds_smr_kind_t kind;                 /**< Scheme of the reclamation */
+  ds_smr_reclaim_fn_t reclaim;        /**< Function which frees the nodes or NULL */
+  void *ctx;                          /**< User context of `reclaim` */
+  atomic_uint_fast64_t epoch;         /**< Global epoch */
+  _Atomic(ds_smr_thread_t *) records; /**< List of the records of the threads */
+};
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Frees the batch of nodes by the reclaim function of the domain.
+ */
+static void reclaim_batch(const ds_smr_t *smr, smr_retired_t *batch, size_t count)
+{
+  if (NULL == smr->reclaim)
+  {
+    free_fn_t mem_free = get_free();
+    for (size_t i = 0; i < count; i++)
+    {
+      mem_free(batch[i].node);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++)
+  {
+    smr->reclaim(smr->ctx, batch[i].node);
+  }
+}
+
+/**
+ * @brief Checks if any thread of the domain holds the hazard pointer to the node.
+ */
+static bool is_hazardous(const ds_smr_t *smr, const void *node)
+{
+  for (ds_smr_thread_t *record = atomic_load_explicit(&smr->records, memory_order_acquire); NULL != record;
+       record = record->next)
+  {
+    for (size_t i = 0; i < DS_SMR_HAZARDS; i++)
+    {
+      if (node == atomic_load_explicit(&record->hazards[i], memory_order_seq_cst))
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Advances the global epoch if all threads inside the sections have observed it.
+ *
+ * @return Current global epoch.
+ */
+static uint64_t try_advance(ds_smr_t *smr)
+{
+  uint_fast64_t epoch = atomic_load_explicit(&smr->epoch, memory_order_seq_cst);
+
+  for (ds_smr_thread_t *record = atomic_load_explicit(&smr->records, memory_order_acquire); NULL != record;
+       record = record->next)
+  {
+    uint_fast64_t local = atomic_load_explicit(&record->epoch, memory_order_seq_cst);
+    if (0 != (local & 1U) && (local >> 1) != epoch)
+    {
+      return epoch;
+    }
+  }
+
+  // The failed CAS means that another thread has advanced the epoch
+  if (atomic_compare_exchange_strong_explicit(&smr->epoch, &epoch, epoch + 1, memory_order_seq_cst,
+                                              memory_order_seq_cst))
+  {
+    return epoch + 1;
+  }
+
+  return epoch;
+}
+
+/**
+ * @brief Checks if the retired node can't be reached by any thread.
+ */
+static bool is_reclaimable(const ds_smr_t *smr, const smr_retired_t *retired, uint64_t epoch)
+{
+  if (DS_SMR_HAZARD == smr->kind)
+  {
+    return !is_hazardous(smr, retired->node);
+  }
+
+  // The threads which could see the node have left their sections in two advances of the epoch
+  return retired->epoch + 2 <= epoch;
+}
+
+/**
+ * @brief Scans the list of retired nodes of the thread, moves the reclaimable ones to its tail and frees them.
+ */
+static size_t scan(ds_smr_thread_t *thread)
+{
+  ds_smr_t *smr = thread->smr;
+  uint64_t epoch = (DS_SMR_EPOCH == smr->kind) ? try_advance(smr) : 0;
+
+  size_t kept = 0;
+  for (size_t i = 0; i < thread->count; i++)
+  {
+    if (!is_reclaimable(smr, &thread->retired[i], epoch))
+    {
+      smr_retired_t retired = thread->retired[i];
+      thread->retired[i] = thread->retired[kept];
+      thread->retired[kept++] = retired;
+    }
+  }
+
+  size_t reclaimed = thread->count - kept;
+  reclaim_batch(smr, thread->retired + kept, reclaimed);
+  thread->count = kept;
+
+  return reclaimed;
+}
+
+/**
+ * @brief Doubles the capacity of the list of retired nodes.
+ */
+static bool grow(ds_smr_thread_t *thread)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  size_t allocated = (0 == thread->allocated) ? DS_SMR_BATCH : thread->allocated * 2;
+  smr_retired_t *retired = (smr_retired_t *)mem_allocate(allocated * sizeof(smr_retired_t));
+  if (NULL == retired)
+  {
+    return false;
+  }
+
+  if (NULL != thread->retired)
+  {
+    memcpy(retired, thread->retired, thread->count * sizeof(smr_retired_t));
+    mem_free(thread->retired);
+  }
+
+  thread->retired = retired;
+  thread->allocated = allocated;
+
+  return true;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the reclamation domain.
+ *
+ * Detailed description see in ds_smr.h
+ */
+ds_smr_t *ds_smr_create(ds_smr_kind_t kind, ds_smr_reclaim_fn_t reclaim, void *ctx)
+{
+  UC_ASSERT(DS_SMR_HAZARD == kind || DS_SMR_EPOCH == kind);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  ds_smr_t *smr = (ds_smr_t *)mem_allocate(sizeof(ds_smr_t));
+  if (NULL == smr)
+  {
+    return NULL;
+  }
+
+  smr->kind = kind;
+  smr->reclaim = reclaim;
+  smr->ctx = ctx;
+  atomic_init(&smr->epoch, 0);
+  atomic_init(&smr->records, NULL);
+
+  return smr;
+}
+
+/**
+ * @brief Frees all retired nodes and deletes the domain.
+ *
+ * Detailed description see in ds_smr.h
+ */
+void ds_smr_delete(ds_smr_t **smr)
+{
+  UC_ASSERT(smr);
+  UC_ASSERT(*smr);
+
+  free_fn_t mem_free = get_free();
+
+  ds_smr_thread_t *record = atomic_load_explicit(&(*smr)->records, memory_order_acquire);
+  while (NULL != record)
+  {
+    ds_smr_thread_t *next = record->next;
+
+    UC_ASSERT(!atomic_load_explicit(&record->used, memory_order_relaxed));
+    reclaim_batch(*smr, record->retired, record->count);
+    if (NULL != record->retired)
+    {
+      mem_free(record->retired);
+    }
+    mem_free(record);
+
+    record = next;
+  }
+
+  mem_free(*smr);
+  *smr = NULL;
+}
+
+/**
+ * @brief Registers the calling thread in the domain.
+ *
+ * Detailed description see in ds_smr.h
+ */
+ds_smr_thread_t *ds_smr_register(ds_smr_t *smr)
+{
+  DS_ASSERT_CHEAP(smr);
+
+  // The record released by the unregistered thread is reused with its retired nodes
+  for (ds_smr_thread_t *record = atomic_load_explicit(&smr->records, memory_order_acquire); NULL != record;
+       record = record->next)
+  {
+    bool used = false;
+    if (!atomic_load_explicit(&record->used, memory_order_relaxed) &&
+        atomic_compare_exchange_strong_explicit(&record->used, &used, true, memory_order_acquire,
+                                                memory_order_relaxed))
+    {
+      return record;
+    }
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  ds_smr_thread_t *record = (ds_smr_thread_t *)mem_allocate(sizeof(ds_smr_thread_t));
+  if (NULL == record)
+  {
+    return NULL;
+  }
+
+  atomic_init(&record->epoch, 0);
+  for (size_t i = 0; i < DS_SMR_HAZARDS; i++)
+  {
+    atomic_init(&record->hazards[i], NULL);
+  }
+  atomic_init(&record->used, true);
+  record->smr = smr;
+  record->retired = NULL;
+  record->count = 0;
+  record->allocated = 0;
+
+  ds_smr_thread_t *head = atomic_load_explicit(&smr->records, memory_order_relaxed);
+  do
+  {
+    record->next = head;
+  } while (!atomic_compare_exchange_weak_explicit(&smr->records, &head, record, memory_order_release,
+                                                  memory_order_relaxed));
+
+  return record;
+}
+
+/**
+ * @brief Releases the record of the thread.
+ *
+ * Detailed description see in ds_smr.h
+ */
+void ds_smr_unregister(ds_smr_thread_t **thread)
+{
+  UC_ASSERT(thread);
+  UC_ASSERT(*thread);
+
+  ds_smr_leave(*thread);
+  scan(*thread);
+  atomic_store_explicit(&(*thread)->used, false, memory_order_release);
+  *thread = NULL;
+}
+
+/**
+ * @brief Enters the section where the thread may read the shared nodes.
+ *
+ * Detailed description see in ds_smr.h
+ */
+void ds_smr_enter(ds_smr_thread_t *thread)
+{
+  DS_ASSERT_CHEAP(thread);
+
+  if (DS_SMR_EPOCH != thread->smr->kind)
+  {
+    return;
+  }
+
+  // The announcement has to be visible before any node is read
+  uint_fast64_t epoch = atomic_load_explicit(&thread->smr->epoch, memory_order_relaxed);
+  atomic_store_explicit(&thread->epoch, epoch << 1 | 1U, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * @brief Leaves the section.
+ *
+ * Detailed description see in ds_smr.h
+ */
+void ds_smr_leave(ds_smr_thread_t *thread)
+{
+  DS_ASSERT_CHEAP(thread);
+
+  if (DS_SMR_EPOCH == thread->smr->kind)
+  {
+    atomic_store_explicit(&thread->epoch, 0, memory_order_release);
+    return;
+  }
+
+  for (size_t i = 0; i < DS_SMR_HAZARDS; i++)
+  {
+    atomic_store_explicit(&thread->hazards[i], NULL, memory_order_release);
+  }
+}
+
+/**
+ * @brief Reads the shared pointer and protects the node it refers to.
+ *
+ * Detailed description see in ds_smr.h
+ */
+void *ds_smr_protect(ds_smr_thread_t *thread, size_t slot, _Atomic(void *) *src)
+{
+  DS_ASSERT_CHEAP(thread);
+  DS_ASSERT_CHEAP(src);
+  DS_ASSERT_CHEAP(slot < DS_SMR_HAZARDS);
+
+  void *node = atomic_load_explicit(src, memory_order_acquire);
+  if (DS_SMR_EPOCH == thread->smr->kind)
+  {
+    return node;
+  }
+
+  // The node is protected only if it is still linked after the hazard pointer became visible to the scans
+  for (;;)
+  {
+    atomic_store_explicit(&thread->hazards[slot], node, memory_order_seq_cst);
+    void *again = atomic_load_explicit(src, memory_order_seq_cst);
+    if (again == node)
+    {
+      return node;
+    }
+    node = again;
+  }
+}
+
+/**
+ * @brief Hands the unlinked node over to the reclamation.
+ *
+ * Detailed description see in ds_smr.h
+ */
+bool ds_smr_retire(ds_smr_thread_t *thread, void *node)
+{
+  DS_ASSERT_CHEAP(thread);
+  DS_ASSERT_CHEAP(node);
+
+  if (thread->count == thread->allocated && !grow(thread))
+  {
+    return false;
+  }
+
+  smr_retired_t *retired = &thread->retired[thread->count++];
+  retired->node = node;
+  retired->epoch = atomic_load_explicit(&thread->smr->epoch, memory_order_seq_cst);
+
+  if (thread->count % DS_SMR_BATCH == 0)
+  {
+    scan(thread);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Reclaims the retired nodes of the thread which are not in use.
+ *
+ * Detailed description see in ds_smr.h
+ */
+size_t ds_smr_flush(ds_smr_thread_t *thread)
+{
+  DS_ASSERT_CHEAP(thread);
+
+  return scan(thread);
+}
+
+/**
+ * @brief Returns the number of nodes retired by the thread and not reclaimed yet.
+ *
+ * Detailed description see in ds_smr.h
+ */
+size_t ds_smr_pending(const ds_smr_thread_t *thread)
+{
+  DS_ASSERT_CHEAP(thread);
+
+  return thread->count;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file    ds_smr.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Safe memory reclamation for the lock-free data structures.
+ * @date    2026-10-18
+ *
+ * The lock-free structure unlinks the node while other threads may still read it, so the node is retired instead
+ * of freed and the reclamation frees it when no thread can reach it anymore. Two schemes are supported:
+ *
+ * - `DS_SMR_HAZARD` - hazard pointers: the thread publishes the pointer to every node it is going to read by
+ *   `ds_smr_protect`, the retired node is freed when no hazard pointer refers to it. The memory held by the
+ *   retired nodes is bounded even if some thread stalls;
+ * - `DS_SMR_EPOCH` - epoch-based reclamation: the thread reads the nodes only between `ds_smr_enter` and
+ *   `ds_smr_leave`, the retired node is freed when all threads in such sections have seen two advances of the
+ *   global epoch. Reading costs nothing, but the stalled thread holds all retired nodes.
+ *
+ * The structure written for both schemes calls `ds_smr_enter`, `ds_smr_protect` for every pointer it follows,
+ * `ds_smr_leave` and `ds_smr_retire` for every unlinked node:
+ *
+ * @code
+ * ds_smr_enter(thread);
+ * node_t *head = ds_smr_protect(thread, 0, &stack->head);
+ * ...
+ * ds_smr_leave(thread);
+ * ds_smr_retire(thread, head);
+ * @endcode
+ *
+ * Every thread registers itself once and keeps the retired nodes in its own list, which is scanned after
+ * `DS_SMR_BATCH` retirements, and the nodes found free are passed to the reclaim function in one batch. By default
+ * they are freed through `allocator_if`. The records of the unregistered threads are reused by the threads
+ * registered later together with the nodes left in their lists, and the remaining nodes are freed when the
+ * reclamation is deleted.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Number of hazard pointers of the single thread */
+#ifndef DS_SMR_HAZARDS
+  #define DS_SMR_HAZARDS 4U
+#endif
+
+/** Number of retired nodes of the thread which triggers the scan of its list */
+#ifndef DS_SMR_BATCH
+  #define DS_SMR_BATCH 64U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief Scheme of the reclamation.
+ */
+typedef enum
+{
+  DS_SMR_HAZARD = 0, /**< Hazard pointers */
+  DS_SMR_EPOCH,      /**< Epoch-based reclamation */
+} ds_smr_kind_t;
+
+/**
+ * @brief Function which frees the node no thread can reach anymore.
+ *
+ * @param[in] ctx User context passed to `ds_smr_create`.
+ * @param[in] node Pointer to the node passed to `ds_smr_retire`.
+ */
+typedef void (*ds_smr_reclaim_fn_t)(void *ctx, void *node);
+
+typedef struct DsSmr_t ds_smr_t;
+typedef struct DsSmrThread_t ds_smr_thread_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the reclamation domain shared by the threads of one or several data structures.
+ *
+ * @param[in] kind Scheme of the reclamation.
+ * @param[in] reclaim Function which frees the nodes or NULL to free them through `allocator_if`.
+ * @param[in] ctx User context passed to `reclaim`.
+ * @return Pointer to the domain or NULL if there is no memory.
+ */
+ds_smr_t *ds_smr_create(ds_smr_kind_t kind, ds_smr_reclaim_fn_t reclaim, void *ctx);
+
+/**
+ * @brief Frees all retired nodes and deletes the domain. There must be no registered threads.
+ *
+ * @param[in] smr Double pointer to the domain.
+ */
+void ds_smr_delete(ds_smr_t **smr);
+
+/**
+ * @brief Registers the calling thread in the domain.
+ *
+ * @param[in] smr Pointer to the domain.
+ * @return Pointer to the record of the thread or NULL if there is no memory.
+ */
+ds_smr_thread_t *ds_smr_register(ds_smr_t *smr);
+
+/**
+ * @brief Leaves the critical section, reclaims what it can and releases the record of the thread.
+ *
+ * @param[in] thread Double pointer to the record of the thread.
+ */
+void ds_smr_unregister(ds_smr_thread_t **thread);
+
+/**
+ * @brief Enters the section where the thread may read the shared nodes. The sections can't be nested.
+ *
+ * @param[in] thread Pointer to the record of the thread.
+ */
+void ds_smr_enter(ds_smr_thread_t *thread);
+
+/**
+ * @brief Leaves the section: clears all hazard pointers of the thread or quits the epoch.
+ *
+ * @param[in] thread Pointer to the record of the thread.
+ */
+void ds_smr_leave(ds_smr_thread_t *thread);
+
+/**
+ * @brief Reads the shared pointer and protects the node it refers to until the slot is reused or the thread
+ *        leaves the section.
+ *
+ * @param[in] thread Pointer to the record of the thread.
+ * @param[in] slot Index of the hazard pointer, less than `DS_SMR_HAZARDS`. Ignored by `DS_SMR_EPOCH`.
+ * @param[in] src Pointer to the shared pointer.
+ * @return Value of the shared pointer which is safe to dereference.
+ */
+void *ds_smr_protect(ds_smr_thread_t *thread, size_t slot, _Atomic(void *) *src);
+
+/**
+ * @brief Hands the unlinked node over to the reclamation. The node mustn't be reachable from the shared memory.
+ *
+ * @param[in] thread Pointer to the record of the thread.
+ * @param[in] node Pointer to the node.
+ * @return true if the node was retired, false if there is no memory for the list, the node isn't retired.
+ */
+bool ds_smr_retire(ds_smr_thread_t *thread, void *node);
+
+/**
+ * @brief Scans the list of retired nodes of the thread and reclaims the nodes which are not in use.
+ *
+ * @param[in] thread Pointer to the record of the thread.
+ * @return Number of reclaimed nodes.
+ */
+size_t ds_smr_flush(ds_smr_thread_t *thread);
+
+/**
+ * @brief Returns the number of nodes retired by the thread and not reclaimed yet.
+ *
+ * @param[in] thread Pointer to the record of the thread.
+ * @return Number of nodes.
+ */
+size_t ds_smr_pending(const ds_smr_thread_t *thread);
@@ -0,0 +1,579 @@
+/**
+ * @file    ds_snapshot.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Binary snapshot of any data structure which supports `ds_t` interface and its restoration.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ds_snapshot.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "structs/queue/queue.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/** Magic number of the snapshot: "UDSS" */
+#define DS_SNAPSHOT_MAGIC 0x53534455U
+
+/**
+ * @brief Fields of the header of the snapshot.
+ */
+typedef struct
+{
+  ds_kind_t kind;  /**< Kind of the data structure */
+  size_t esize;    /**< Size in bytes of the single element */
+  size_t capacity; /**< Capacity passed to the constructor */
+  size_t count;    /**< Number of elements */
+} header_t;
+
+struct DsSnapshotStream_t
+{
+  const ds_t *ds;                           /**< Data structure which is saved */
+  uint8_t header[DS_SNAPSHOT_HEADER_SIZE]; /**< Encoded header */
+  size_t offset;                            /**< Number of produced bytes of the header */
+  void *pos;                                /**< Position of the current span */
+  const uint8_t *data;                      /**< Not yet produced part of the current span */
+  size_t left;                              /**< Size in bytes of the not yet produced part */
+};
+
+struct DsRestoreStream_t
+{
+  uint8_t header[DS_SNAPSHOT_HEADER_SIZE]; /**< Received part of the header */
+  size_t offset;                            /**< Number of received bytes of the header */
+  header_t info;                            /**< Decoded header */
+  ds_t *ds;                                 /**< Data structure which is restored */
+  size_t left;                              /**< Number of elements which weren't received yet */
+  size_t partial;                           /**< Number of received bytes of the incomplete element */
+  bool failed;                              /**< The snapshot was rejected */
+  uint8_t *element;                         /**< Buffer for the element split between the pieces */
+};
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Stores the value as `size` little endian bytes.
+ */
+static void put_le(uint8_t *dst, uint64_t value, size_t size)
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    dst[i] = (uint8_t)(value >> (8 * i));
+  }
+}
+
+/**
+ * @brief Loads the value of `size` little endian bytes.
+ */
+static uint64_t get_le(const uint8_t *src, size_t size)
+{
+  uint64_t value = 0;
+
+  for (size_t i = 0; i < size; i++)
+  {
+    value |= (uint64_t)src[i] << (8 * i);
+  }
+
+  return value;
+}
+
+/**
+ * @brief Returns the number of elements of the data structure.
+ */
+static size_t count_elements(const ds_t *ds)
+{
+  size_t count = 0;
+  void *pos = NULL;
+  ds_span_t span;
+
+  while (ds->iface->next_span(ds, &pos, &span))
+  {
+    count += span.count;
+  }
+
+  return count;
+}
+
+/**
+ * @brief Encodes the header of the snapshot of the data structure.
+ */
+static void encode_header(const ds_t *ds, uint8_t *header)
+{
+  // The elements of MPSC queue are restored into the ordinary queue
+  ds_kind_t kind = (DS_KIND_QUEUE_MPSC == ds->iface->kind) ? DS_KIND_QUEUE : ds->iface->kind;
+
+  put_le(header, DS_SNAPSHOT_MAGIC, 4);
+  put_le(header + 4, DS_SNAPSHOT_VERSION, 2);
+  put_le(header + 6, (uint64_t)kind, 2);
+  put_le(header + 8, ds->iface->esize(ds), 8);
+  put_le(header + 16, ds->iface->capacity(ds), 8);
+  put_le(header + 24, count_elements(ds), 8);
+}
+
+/**
+ * @brief Decodes and validates the header of the snapshot.
+ */
+static bool decode_header(const uint8_t *header, header_t *info)
+{
+  uint64_t kind = get_le(header + 6, 2);
+  uint64_t esize = get_le(header + 8, 8);
+  uint64_t capacity = get_le(header + 16, 8);
+  uint64_t count = get_le(header + 24, 8);
+
+  if (DS_SNAPSHOT_MAGIC != get_le(header, 4) || DS_SNAPSHOT_VERSION != get_le(header + 4, 2))
+  {
+    return false;
+  }
+
+  if (kind < DS_KIND_STACK || kind > DS_KIND_RING_BUFFER || 0 == esize || esize > SIZE_MAX ||
+      capacity > SIZE_MAX || count > SIZE_MAX / esize)
+  {
+    return false;
+  }
+
+  // The ring buffer keeps one slot free
+  if ((DS_KIND_RING_BUFFER == kind && count >= capacity) || (0 != capacity && count > capacity))
+  {
+    return false;
+  }
+
+  info->kind = (ds_kind_t)kind;
+  info->esize = (size_t)esize;
+  info->capacity = (size_t)capacity;
+  info->count = (size_t)count;
+
+  return true;
+}
+
+/**
+ * @brief Creates the empty data structure described by the header.
+ */
+static ds_t *create_ds(const header_t *info)
+{
+  switch (info->kind)
+  {
+    case DS_KIND_STACK: return stack_create(info->capacity, info->esize);
+    case DS_KIND_QUEUE: return queue_create(info->capacity, info->esize);
+    case DS_KIND_RING_BUFFER: return rb_create(info->capacity, info->esize);
+    default: return NULL;
+  }
+}
+
+/**
+ * @brief Deletes the data structure created by `create_ds`.
+ */
+static void delete_ds(ds_t **ds)
+{
+  switch ((*ds)->iface->kind)
+  {
+    case DS_KIND_STACK: stack_delete(ds); break;
+    case DS_KIND_QUEUE: queue_delete(ds); break;
+    case DS_KIND_RING_BUFFER: rb_delete(ds); break;
+    default: break;
+  }
+}
+
+/**
+ * @brief Appends `count` elements to the end of the data structure in the order of `ds_t` interface.
+ */
+static bool append(ds_t *ds, const uint8_t *data, size_t count, size_t esize)
+{
+  switch (ds->iface->kind)
+  {
+    case DS_KIND_RING_BUFFER: return rb_add_batch(ds, data, count);
+    case DS_KIND_STACK:
+      for (size_t i = 0; i < count; i++)
+      {
+        if (!stack_push(ds, data + i * esize))
+        {
+          return false;
+        }
+      }
+      return true;
+    case DS_KIND_QUEUE:
+      for (size_t i = 0; i < count; i++)
+      {
+        if (!queue_add(ds, data + i * esize))
+        {
+          return false;
+        }
+      }
+      return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Receives the part of the header, creates the data structure when the header is complete.
+ *
+ * @return Number of consumed bytes.
+ */
+static size_t feed_header(ds_restore_stream_t *stream, const uint8_t *data, size_t size)
+{
+  size_t n = DS_SNAPSHOT_HEADER_SIZE - stream->offset;
+  n = (size < n) ? size : n;
+
+  memcpy(stream->header + stream->offset, data, n);
+  stream->offset += n;
+
+  if (DS_SNAPSHOT_HEADER_SIZE != stream->offset)
+  {
+    return n;
+  }
+
+  if (!decode_header(stream->header, &stream->info))
+  {
+    stream->failed = true;
+    return n;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  stream->ds = create_ds(&stream->info);
+  stream->element = (uint8_t *)mem_allocate(stream->info.esize);
+  stream->left = stream->info.count;
+  stream->failed = (NULL == stream->ds || NULL == stream->element);
+
+  return n;
+}
+
+/**
+ * @brief Returns the number of bytes which the restore stream still expects.
+ */
+static size_t bytes_expected(const ds_restore_stream_t *stream)
+{
+  if (DS_SNAPSHOT_HEADER_SIZE != stream->offset)
+  {
+    return DS_SNAPSHOT_HEADER_SIZE - stream->offset;
+  }
+
+  return stream->left * stream->info.esize - stream->partial;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Returns the size in bytes of the snapshot of the data structure.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+size_t ds_snapshot_size(const ds_t *ds)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(ds->iface);
+
+  return DS_SNAPSHOT_HEADER_SIZE + count_elements(ds) * ds->iface->esize(ds);
+}
+
+/**
+ * @brief Writes the snapshot of the data structure.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+bool ds_snapshot(const ds_t *ds, const ds_writer_t *writer)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(ds->iface);
+  UC_ASSERT(writer);
+  UC_ASSERT(writer->write);
+
+  uint8_t chunk[DS_SNAPSHOT_CHUNK];
+  size_t used = DS_SNAPSHOT_HEADER_SIZE;
+  size_t esize = ds->iface->esize(ds);
+
+  encode_header(ds, chunk);
+
+  void *pos = NULL;
+  ds_span_t span;
+
+  while (ds->iface->next_span(ds, &pos, &span))
+  {
+    size_t bytes = span.count * esize;
+
+    if (used + bytes <= DS_SNAPSHOT_CHUNK)
+    {
+      memcpy(chunk + used, span.data, bytes);
+      used += bytes;
+      continue;
+    }
+
+    if (0 != used && !writer->write(writer->ctx, chunk, used))
+    {
+      return false;
+    }
+    used = 0;
+
+    // Large spans are written directly from the storage
+    if (bytes >= DS_SNAPSHOT_CHUNK)
+    {
+      if (!writer->write(writer->ctx, span.data, bytes))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      memcpy(chunk, span.data, bytes);
+      used = bytes;
+    }
+  }
+
+  return (0 == used) || writer->write(writer->ctx, chunk, used);
+}
+
+/**
+ * @brief Creates the data structure from the snapshot.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+ds_t *ds_restore(const ds_reader_t *reader)
+{
+  UC_ASSERT(reader);
+  UC_ASSERT(reader->read);
+
+  ds_restore_stream_t *stream = ds_restore_begin();
+  if (NULL == stream)
+  {
+    return NULL;
+  }
+
+  uint8_t chunk[DS_SNAPSHOT_CHUNK];
+
+  // The reader is asked exactly for the rest of the snapshot, so it never reads past its end
+  for (size_t expected = bytes_expected(stream); 0 != expected && !stream->failed; expected = bytes_expected(stream))
+  {
+    size_t n = (expected < DS_SNAPSHOT_CHUNK) ? expected : DS_SNAPSHOT_CHUNK;
+
+    if (!reader->read(reader->ctx, chunk, n))
+    {
+      break;
+    }
+
+    ds_restore_feed(stream, chunk, n);
+  }
+
+  return ds_restore_end(&stream);
+}
+
+/**
+ * @brief Starts producing the snapshot of the data structure piece by piece.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+ds_snapshot_stream_t *ds_snapshot_begin(const ds_t *ds)
+{
+  UC_ASSERT(ds);
+  UC_ASSERT(ds->iface);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  ds_snapshot_stream_t *stream = (ds_snapshot_stream_t *)mem_allocate(sizeof(ds_snapshot_stream_t));
+  if (NULL == stream)
+  {
+    return NULL;
+  }
+
+  stream->ds = ds;
+  encode_header(ds, stream->header);
+  stream->offset = 0;
+  stream->pos = NULL;
+  stream->data = NULL;
+  stream->left = 0;
+
+  return stream;
+}
+
+/**
+ * @brief Copies the next piece of the snapshot.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+size_t ds_snapshot_next(ds_snapshot_stream_t *stream, void *buffer, size_t size)
+{
+  UC_ASSERT(stream);
+  UC_ASSERT(buffer || 0 == size);
+
+  uint8_t *dst = (uint8_t *)buffer;
+  size_t produced = 0;
+
+  if (DS_SNAPSHOT_HEADER_SIZE != stream->offset)
+  {
+    size_t n = DS_SNAPSHOT_HEADER_SIZE - stream->offset;
+    n = (size < n) ? size : n;
+
+    memcpy(dst, stream->header + stream->offset, n);
+    stream->offset += n;
+    produced = n;
+  }
+
+  const ds_t *ds = stream->ds;
+
+  while (produced < size)
+  {
+    if (0 == stream->left)
+    {
+      ds_span_t span;
+      if (!ds->iface->next_span(ds, &stream->pos, &span))
+      {
+        break;
+      }
+
+      stream->data = (const uint8_t *)span.data;
+      stream->left = span.count * ds->iface->esize(ds);
+      continue;
+    }
+
+    size_t n = size - produced;
+    n = (stream->left < n) ? stream->left : n;
+
+    memcpy(dst + produced, stream->data, n);
+    stream->data += n;
+    stream->left -= n;
+    produced += n;
+  }
+
+  return produced;
+}
+
+/**
+ * @brief Frees up the memory associated with the stream.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+void ds_snapshot_end(ds_snapshot_stream_t **stream)
+{
+  UC_ASSERT(stream);
+  UC_ASSERT(*stream);
+
+  free_fn_t mem_free = get_free();
+  mem_free(*stream);
+
+  *stream = NULL;
+}
+
+/**
+ * @brief Starts restoring the data structure from the pieces of the snapshot.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+ds_restore_stream_t *ds_restore_begin(void)
+{
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  ds_restore_stream_t *stream = (ds_restore_stream_t *)mem_allocate(sizeof(ds_restore_stream_t));
+  if (NULL == stream)
+  {
+    return NULL;
+  }
+
+  memset(stream, 0, sizeof(ds_restore_stream_t));
+
+  return stream;
+}
+
+/**
+ * @brief Passes the next piece of the snapshot.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+bool ds_restore_feed(ds_restore_stream_t *stream, const void *data, size_t size)
+{
+  UC_ASSERT(stream);
+  UC_ASSERT(data || 0 == size);
+
+  const uint8_t *src = (const uint8_t *)data;
+
+  while (0 != size && !stream->failed)
+  {
+    if (DS_SNAPSHOT_HEADER_SIZE != stream->offset)
+    {
+      size_t n = feed_header(stream, src, size);
+      src += n;
+      size -= n;
+      continue;
+    }
+
+    size_t esize = stream->info.esize;
+
+    if (0 == stream->left)
+    {
+      // The data past the end of the snapshot
+      stream->failed = true;
+    }
+    else if (0 != stream->partial || size < esize)
+    {
+      size_t n = esize - stream->partial;
+      n = (size < n) ? size : n;
+
+      memcpy(stream->element + stream->partial, src, n);
+      stream->partial += n;
+      src += n;
+      size -= n;
+
+      if (esize == stream->partial)
+      {
+        stream->failed = !append(stream->ds, stream->element, 1, esize);
+        stream->partial = 0;
+        stream->left--;
+      }
+    }
+    else
+    {
+      // Whole elements are appended right from the piece
+      size_t count = size / esize;
+      count = (stream->left < count) ? stream->left : count;
+
+      stream->failed = !append(stream->ds, src, count, esize);
+      stream->left -= count;
+      src += count * esize;
+      size -= count * esize;
+    }
+  }
+
+  return !stream->failed;
+}
+
+/**
+ * @brief Finishes restoring and frees up the memory associated with the stream.
+ *
+ * Detailed description see in ds_snapshot.h
+ */
+ds_t *ds_restore_end(ds_restore_stream_t **stream)
+{
+  UC_ASSERT(stream);
+  UC_ASSERT(*stream);
+
+  ds_restore_stream_t *s = *stream;
+  ds_t *ds = s->ds;
+
+  if (NULL != ds && (s->failed || 0 != bytes_expected(s)))
+  {
+    delete_ds(&ds);
+  }
+
+  free_fn_t mem_free = get_free();
+  if (NULL != s->element)
+  {
+    mem_free(s->element);
+  }
+  mem_free(s);
+
+  *stream = NULL;
+
+  return ds;
+}
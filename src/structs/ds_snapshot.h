@@ -0,0 +1,152 @@
+/**
+ * @file    ds_snapshot.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Binary snapshot of any data structure which supports `ds_t` interface and its restoration.
+ * @date    2026-10-18
+ *
+ * The snapshot consists of the header and the elements in the order of `ds_t` interface:
+ *
+ * | Offset | Size | Field                                                  |
+ * |--------|------|--------------------------------------------------------|
+ * | 0      | 4    | Magic number "UDSS"                                    |
+ * | 4      | 2    | Version of the format, `DS_SNAPSHOT_VERSION`           |
+ * | 6      | 2    | Kind of the data structure, `ds_kind_t`, MPSC as queue |
+ * | 8      | 8    | Size in bytes of the single element                    |
+ * | 16     | 8    | Capacity passed to the constructor or 0 if unlimited   |
+ * | 24     | 8    | Number of elements                                     |
+ * | 32     | ...  | Elements                                               |
+ *
+ * The fields of the header are little endian, the elements are stored as they are placed in memory. The
+ * contiguous spans of the storage are written by one call of the writer, the elements of lists are gathered
+ * into chunks of `DS_SNAPSHOT_CHUNK` bytes.
+ *
+ * Besides `ds_snapshot`/`ds_restore`, which call the writer or the reader until the whole snapshot is
+ * transferred, the snapshot can be produced and consumed piece by piece by the stream functions, e.g. when the
+ * data comes from non-blocking socket.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "structs/ds.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Size in bytes of the chunk which gathers small spans before they are passed to the writer */
+#ifndef DS_SNAPSHOT_CHUNK
+  #define DS_SNAPSHOT_CHUNK 4096U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/** Version of the format of the snapshot */
+#define DS_SNAPSHOT_VERSION 1U
+
+/** Size in bytes of the header of the snapshot */
+#define DS_SNAPSHOT_HEADER_SIZE 32U
+
+/**
+ * @brief Writes `size` bytes of the snapshot, returns false on error.
+ */
+typedef bool (*ds_write_fn_t)(void *ctx, const void *data, size_t size);
+
+/**
+ * @brief Reads exactly `size` bytes of the snapshot, returns false on error or end of data.
+ */
+typedef bool (*ds_read_fn_t)(void *ctx, void *data, size_t size);
+
+typedef struct
+{
+  ds_write_fn_t write; /**< Function which writes the data */
+  void *ctx;           /**< Context passed to `write`, e.g. file */
+} ds_writer_t;
+
+typedef struct
+{
+  ds_read_fn_t read; /**< Function which reads the data */
+  void *ctx;         /**< Context passed to `read`, e.g. file */
+} ds_reader_t;
+
+typedef struct DsSnapshotStream_t ds_snapshot_stream_t;
+typedef struct DsRestoreStream_t ds_restore_stream_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Returns the size in bytes of the snapshot of the data structure.
+ *
+ * @param[in] ds Pointer to the data structure.
+ * @return Size in bytes of the snapshot.
+ */
+size_t ds_snapshot_size(const ds_t *ds);
+
+/**
+ * @brief Writes the snapshot of the data structure.
+ *
+ * @param[in] ds Pointer to the data structure.
+ * @param[in] writer Destination of the snapshot.
+ * @return true if the operation was successful, false if the writer failed.
+ */
+bool ds_snapshot(const ds_t *ds, const ds_writer_t *writer);
+
+/**
+ * @brief Creates the data structure from the snapshot.
+ *
+ * The ring buffer placed in the file, in the shared memory etc. is restored as the ordinary one.
+ *
+ * @param[in] reader Source of the snapshot.
+ * @return Pointer to the new data structure or NULL if the snapshot is corrupted or the reader failed.
+ */
+ds_t *ds_restore(const ds_reader_t *reader);
+
+/**
+ * @brief Starts producing the snapshot of the data structure piece by piece.
+ *
+ * @param[in] ds Pointer to the data structure.
+ * @warning The data structure must not be changed until `ds_snapshot_end` is called.
+ * @return Pointer to the stream or NULL if there is no memory.
+ */
+ds_snapshot_stream_t *ds_snapshot_begin(const ds_t *ds);
+
+/**
+ * @brief Copies the next piece of the snapshot.
+ *
+ * @param[in] stream Pointer to the stream.
+ * @param[out] buffer Buffer for the piece.
+ * @param[in] size Size in bytes of the buffer.
+ * @return Number of copied bytes, less than `size` only at the end of the snapshot.
+ */
+size_t ds_snapshot_next(ds_snapshot_stream_t *stream, void *buffer, size_t size);
+
+/**
+ * @brief Frees up the memory associated with the stream.
+ *
+ * @param[in] stream Double pointer to the stream.
+ */
+void ds_snapshot_end(ds_snapshot_stream_t **stream);
+
+/**
+ * @brief Starts restoring the data structure from the pieces of the snapshot.
+ *
+ * @return Pointer to the stream or NULL if there is no memory.
+ */
+ds_restore_stream_t *ds_restore_begin(void);
+
+/**
+ * @brief Passes the next piece of the snapshot. The piece can have any size.
+ *
+ * @param[in] stream Pointer to the stream.
+ * @param[in] data Pointer to the piece.
+ * @param[in] size Size in bytes of the piece.
+ * @return true if the operation was successful, false if the snapshot is corrupted or there is no memory.
+ *         After the error the stream only has to be finished by `ds_restore_end`.
+ */
+bool ds_restore_feed(ds_restore_stream_t *stream, const void *data, size_t size);
+
+/**
+ * @brief Finishes restoring and frees up the memory associated with the stream.
+ *
+ * @param[in] stream Double pointer to the stream.
+ * @return Pointer to the new data structure or NULL if the snapshot was incomplete or corrupted.
+ */
+ds_t *ds_restore_end(ds_restore_stream_t **stream);
@@ -0,0 +1,500 @@
+/**
+ * @file    ds_sync.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Synchronized access to the stack, the queue and the ring buffer from several threads.
+ * @date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ds_sync.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_assert.h"
+#include "structs/queue/queue.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 to build the library without pthread, all locks are then the ticket spinlock */
+#ifndef DS_SYNC_USE_PTHREAD
+  #if defined(__unix__) || defined(__APPLE__)
+    #define DS_SYNC_USE_PTHREAD 1
+  #else
+    #define DS_SYNC_USE_PTHREAD 0
+  #endif
+#endif
+
+/** Number of checks of the ticket after which the waiting thread yields the processor */
+#ifndef DS_SYNC_SPIN_LIMIT
+  #define DS_SYNC_SPIN_LIMIT 64U
+#endif
+
+#if DS_SYNC_USE_PTHREAD
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief Ticket spinlock: the thread takes the ticket and waits until it is served.
+ */
+typedef struct
+{
+  atomic_uint next;    /**< Next ticket to take */
+  atomic_uint serving; /**< Ticket which holds the lock */
+} ticket_lock_t;
+
+struct DsSync_t
+{
+  _Alignas(DS_SYNC_CACHE_LINE) union
+  {
+    ticket_lock_t ticket;
+#if DS_SYNC_USE_PTHREAD
+    pthread_mutex_t mutex;
+    pthread_rwlock_t rwlock;
+#endif
+  } lock;         /**< Lock of the kind `kind` */
+  ds_lock_t kind; /**< Kind of the lock */
+  ds_t *ds;       /**< Guarded data structure */
+  void *block;    /**< Allocated block which contains the wrapper at the boundary of the cache line */
+};
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Waits for the turn of the calling thread.
+ */
+static void ticket_lock(ticket_lock_t *lock)
+{
+  unsigned ticket = atomic_fetch_add_explicit(&lock->next, 1, memory_order_relaxed);
+
+  for (unsigned spins = 0; atomic_load_explicit(&lock->serving, memory_order_acquire) != ticket; spins++)
+  {
+#if DS_SYNC_USE_PTHREAD
+    if (spins >= DS_SYNC_SPIN_LIMIT)
+    {
+      sched_yield();
+    }
+#endif
+  }
+}
+
+/**
+ * @brief Passes the lock to the next ticket.
+ */
+static void ticket_unlock(ticket_lock_t *lock)
+{
+  unsigned serving = atomic_load_explicit(&lock->serving, memory_order_relaxed);
+  atomic_store_explicit(&lock->serving, serving + 1, memory_order_release);
+}
+
+/**
+ * @brief Puts the element into the data structure of any kind. The lock has to be held.
+ */
+static bool put(ds_t *ds, const void *data)
+{
+  switch (ds->iface->kind)
+  {
+    case DS_KIND_STACK:
+      return stack_push(ds, data);
+    case DS_KIND_QUEUE:
+      return queue_add(ds, data);
+    case DS_KIND_RING_BUFFER:
+      return rb_add(ds, data);
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Takes the element from the data structure of any kind. The lock has to be held.
+ */
+static bool take(ds_t *ds, void *data)
+{
+  switch (ds->iface->kind)
+  {
+    case DS_KIND_STACK:
+      return stack_pop(ds, data);
+    case DS_KIND_QUEUE:
+      return queue_get(ds, data);
+    case DS_KIND_RING_BUFFER:
+      return rb_get(ds, data);
+    default:
+      return false;
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the synchronized wrapper which takes the ownership of the data structure.
+ *
+ * Detailed description see in ds_sync.h
+ */
+ds_sync_t *ds_sync_create(ds_t *ds, ds_lock_t lock)
+{
+  if (NULL == ds || !is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  UC_ASSERT(ds->iface);
+
+  // Other kinds, e.g. MPSC queue, have their own functions which the wrapper doesn't call
+  if (DS_KIND_STACK != ds->iface->kind && DS_KIND_QUEUE != ds->iface->kind && DS_KIND_RING_BUFFER != ds->iface->kind)
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  // The allocator gives no alignment to the cache line, so the wrapper is shifted to the boundary inside the block
+  void *block = mem_allocate(sizeof(ds_sync_t) + DS_SYNC_CACHE_LINE - 1);
+  if (NULL == block)
+  {
+    return NULL;
+  }
+
+  ds_sync_t *sync =
+    (ds_sync_t *)(((uintptr_t)block + DS_SYNC_CACHE_LINE - 1) & ~(uintptr_t)(DS_SYNC_CACHE_LINE - 1));
+  sync->block = block;
+  sync->kind = lock;
+  sync->ds = ds;
+
+#if DS_SYNC_USE_PTHREAD
+  int rc = 0;
+  switch (lock)
+  {
+    case DS_LOCK_MUTEX:
+      rc = pthread_mutex_init(&sync->lock.mutex, NULL);
+      break;
+    case DS_LOCK_RWLOCK:
+      rc = pthread_rwlock_init(&sync->lock.rwlock, NULL);
+      break;
+    default:
+      sync->kind = DS_LOCK_TICKET;
+      break;
+  }
+
+  if (0 != rc)
+  {
+    mem_free(block);
+    return NULL;
+  }
+#else
+  (void)mem_free;
+  sync->kind = DS_LOCK_TICKET;
+#endif
+
+  if (DS_LOCK_TICKET == sync->kind)
+  {
+    atomic_init(&sync->lock.ticket.next, 0);
+    atomic_init(&sync->lock.ticket.serving, 0);
+  }
+
+  return sync;
+}
+
+/**
+ * @brief Deletes the wrapper together with the data structure.
+ *
+ * Detailed description see in ds_sync.h
+ */
+void ds_sync_delete(ds_sync_t **sync)
+{
+  UC_ASSERT(sync);
+  UC_ASSERT(*sync);
+
+  ds_t *ds = (*sync)->ds;
+  switch (ds->iface->kind)
+  {
+    case DS_KIND_STACK:
+      stack_delete(&ds);
+      break;
+    case DS_KIND_QUEUE:
+      queue_delete(&ds);
+      break;
+    case DS_KIND_RING_BUFFER:
+      rb_delete(&ds);
+      break;
+    default:
+      break;
+  }
+
+#if DS_SYNC_USE_PTHREAD
+  if (DS_LOCK_MUTEX == (*sync)->kind)
+  {
+    pthread_mutex_destroy(&(*sync)->lock.mutex);
+  }
+  else if (DS_LOCK_RWLOCK == (*sync)->kind)
+  {
+    pthread_rwlock_destroy(&(*sync)->lock.rwlock);
+  }
+#endif
+
+  free_fn_t mem_free = get_free();
+  mem_free((*sync)->block);
+  *sync = NULL;
+}
+
+/**
+ * @brief Returns the wrapped data structure.
+ *
+ * Detailed description see in ds_sync.h
+ */
+ds_t *ds_sync_ds(const ds_sync_t *sync)
+{
+  DS_ASSERT_CHEAP(sync);
+
+  return sync->ds;
+}
+
+/**
+ * @brief Acquires the lock exclusively.
+ *
+ * Detailed description see in ds_sync.h
+ */
+void ds_sync_lock(ds_sync_t *sync)
+{
+  DS_ASSERT_CHEAP(sync);
+
+  switch (sync->kind)
+  {
+#if DS_SYNC_USE_PTHREAD
+    case DS_LOCK_MUTEX:
+      pthread_mutex_lock(&sync->lock.mutex);
+      break;
+    case DS_LOCK_RWLOCK:
+      pthread_rwlock_wrlock(&sync->lock.rwlock);
+      break;
+#endif
+    default:
+      ticket_lock(&sync->lock.ticket);
+      break;
+  }
+}
+
+/**
+ * @brief Releases the lock acquired by `ds_sync_lock`.
+ *
+ * Detailed description see in ds_sync.h
+ */
+void ds_sync_unlock(ds_sync_t *sync)
+{
+  DS_ASSERT_CHEAP(sync);
+
+  switch (sync->kind)
+  {
+#if DS_SYNC_USE_PTHREAD
+    case DS_LOCK_MUTEX:
+      pthread_mutex_unlock(&sync->lock.mutex);
+      break;
+    case DS_LOCK_RWLOCK:
+      pthread_rwlock_unlock(&sync->lock.rwlock);
+      break;
+#endif
+    default:
+      ticket_unlock(&sync->lock.ticket);
+      break;
+  }
+}
+
+/**
+ * @brief Acquires the lock for reading.
+ *
+ * Detailed description see in ds_sync.h
+ */
+void ds_sync_lock_shared(ds_sync_t *sync)
+{
+  DS_ASSERT_CHEAP(sync);
+
+#if DS_SYNC_USE_PTHREAD
+  if (DS_LOCK_RWLOCK == sync->kind)
+  {
+    pthread_rwlock_rdlock(&sync->lock.rwlock);
+    return;
+  }
+#endif
+
+  ds_sync_lock(sync);
+}
+
+/**
+ * @brief Releases the lock acquired by `ds_sync_lock_shared`.
+ *
+ * Detailed description see in ds_sync.h
+ */
+void ds_sync_unlock_shared(ds_sync_t *sync)
+{
+  // The reader-writer lock is released by the same function in both modes
+  ds_sync_unlock(sync);
+}
+
+/**
+ * @brief Pushes or adds the element.
+ *
+ * Detailed description see in ds_sync.h
+ */
+bool ds_sync_put(ds_sync_t *sync, const void *data)
+{
+  DS_ASSERT_CHEAP(sync);
+  DS_ASSERT_CHEAP(data);
+
+  ds_sync_lock(sync);
+  bool status = put(sync->ds, data);
+  ds_sync_unlock(sync);
+
+  return status;
+}
+
+/**
+ * @brief Pops or retrieves the element.
+ *
+ * Detailed description see in ds_sync.h
+ */
+bool ds_sync_take(ds_sync_t *sync, void *data)
+{
+  DS_ASSERT_CHEAP(sync);
+  DS_ASSERT_CHEAP(data);
+
+  ds_sync_lock(sync);
+  bool status = take(sync->ds, data);
+  ds_sync_unlock(sync);
+
+  return status;
+}
+
+/**
+ * @brief Copies the element which would be taken next without removing it.
+ *
+ * Detailed description see in ds_sync.h
+ */
+bool ds_sync_peek(ds_sync_t *sync, void *data)
+{
+  DS_ASSERT_CHEAP(sync);
+  DS_ASSERT_CHEAP(data);
+
+  bool status = false;
+
+  ds_sync_lock_shared(sync);
+  switch (sync->ds->iface->kind)
+  {
+    case DS_KIND_STACK:
+      status = stack_peek(sync->ds, data);
+      break;
+    case DS_KIND_QUEUE:
+      status = queue_peek(sync->ds, data);
+      break;
+    case DS_KIND_RING_BUFFER:
+      status = rb_peek(sync->ds, data);
+      break;
+    default:
+      break;
+  }
+  ds_sync_unlock_shared(sync);
+
+  return status;
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * Detailed description see in ds_sync.h
+ */
+size_t ds_sync_size(ds_sync_t *sync)
+{
+  DS_ASSERT_CHEAP(sync);
+
+  size_t size = 0;
+
+  ds_sync_lock_shared(sync);
+  switch (sync->ds->iface->kind)
+  {
+    case DS_KIND_STACK:
+      size = stack_size(sync->ds);
+      break;
+    case DS_KIND_QUEUE:
+      size = queue_size(sync->ds);
+      break;
+    case DS_KIND_RING_BUFFER:
+      size = rb_size(sync->ds);
+      break;
+    default:
+      break;
+  }
+  ds_sync_unlock_shared(sync);
+
+  return size;
+}
+
+/**
+ * @brief Puts the array of elements under the single acquisition of the lock.
+ *
+ * Detailed description see in ds_sync.h
+ */
+size_t ds_sync_put_batch(ds_sync_t *sync, const void *data, size_t count)
+{
+  DS_ASSERT_CHEAP(sync);
+  DS_ASSERT_CHEAP(data || 0 == count);
+
+  ds_t *ds = sync->ds;
+  size_t esize = ds->iface->esize(ds);
+  size_t n = 0;
+
+  ds_sync_lock(sync);
+  // The ring buffer copies the whole batch by one or two `memcpy`, unless it has several producers
+  if (DS_KIND_RING_BUFFER == ds->iface->kind && !rb_is_multi_producer(ds))
+  {
+    ds_span_t first;
+    ds_span_t second;
+    size_t slots = rb_get_free_spans(ds, &first, &second);
+    n = (count < slots) ? count : slots;
+    rb_add_batch(ds, data, n);
+  }
+  else
+  {
+    while (n < count && put(ds, (const uint8_t *)data + n * esize))
+    {
+      n++;
+    }
+  }
+  ds_sync_unlock(sync);
+
+  return n;
+}
+
+/**
+ * @brief Takes up to `count` elements under the single acquisition of the lock.
+ *
+ * Detailed description see in ds_sync.h
+ */
+size_t ds_sync_take_batch(ds_sync_t *sync, void *data, size_t count)
+{
+  DS_ASSERT_CHEAP(sync);
+  DS_ASSERT_CHEAP(data || 0 == count);
+
+  ds_t *ds = sync->ds;
+  size_t esize = ds->iface->esize(ds);
+  size_t n = 0;
+
+  ds_sync_lock(sync);
+  if (DS_KIND_RING_BUFFER == ds->iface->kind)
+  {
+    size_t size = rb_size(ds);
+    n = (count < size) ? count : size;
+    rb_get_batch(ds, data, n);
+  }
+  else
+  {
+    while (n < count && take(ds, (uint8_t *)data + n * esize))
+    {
+      n++;
+    }
+  }
+  ds_sync_unlock(sync);
+
+  return n;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file    ds_sync.h
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Synchronized access to the stack, the queue and the ring buffer from several threads.
+ * @date    2026-10-18
+ *
+ * The wrapper owns the data structure and the lock which guards it. The lock is selected by `ds_lock_t`:
+ *
+ * - `DS_LOCK_MUTEX` is the mutex of pthread, threads which wait for it sleep;
+ * - `DS_LOCK_TICKET` is the ticket spinlock which grants the lock in the order of arrival and fits the short
+ *   critical sections of the busy threads;
+ * - `DS_LOCK_RWLOCK` is the reader-writer lock of pthread: `ds_sync_peek` and `ds_sync_size` hold it shared,
+ *   so the readers don't block each other.
+ *
+ * The lock and the pointer to the data structure are placed in the same block, so there is no separate
+ * allocation per lock. The block starts at the boundary of the cache line and takes whole lines, so the lock
+ * never shares its line with the neighbouring allocations, e.g. with the locks and the data structures of
+ * other wrappers. The data structure itself is created by its constructor and stays in its own block. The
+ * operations `ds_sync_put` and `ds_sync_take` are pushing/popping of the stack and adding/retrieving of the
+ * queue and the ring buffer. The batch operations and the sequences of any functions of the data structure are
+ * done under one acquisition:
+ *
+ * @code
+ * ds_sync_lock(sync);
+ * queue_t *queue = ds_sync_ds(sync);
+ * while (queue_get(queue, &item)) { ... }
+ * ds_sync_unlock(sync);
+ * @endcode
+ *
+ * Without pthread (`DS_SYNC_USE_PTHREAD` is 0) all kinds of locks are the ticket spinlock.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "structs/ds.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Size of the cache line which the wrapper occupies exclusively */
+#ifndef DS_SYNC_CACHE_LINE
+  #define DS_SYNC_CACHE_LINE 64U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * @brief Kind of the lock which guards the data structure.
+ */
+typedef enum
+{
+  DS_LOCK_MUTEX = 0, /**< Mutex, the waiting threads sleep */
+  DS_LOCK_TICKET,    /**< Fair spinlock for the short critical sections */
+  DS_LOCK_RWLOCK,    /**< Reader-writer lock for the workloads dominated by peeking and size queries */
+} ds_lock_t;
+
+typedef struct DsSync_t ds_sync_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the synchronized wrapper which takes the ownership of the data structure.
+ *
+ * @param[in] ds Pointer to the stack, the queue or the ring buffer. NULL is passed through, so the result of
+ *               the constructor can be wrapped directly.
+ * @param[in] lock Kind of the lock.
+ * @return Pointer to the wrapper or NULL if `ds` is NULL, isn't the stack, the queue or the ring buffer or there
+ *         is no memory. The data structure isn't deleted on failure.
+ */
+ds_sync_t *ds_sync_create(ds_t *ds, ds_lock_t lock);
+
+/**
+ * @brief Deletes the wrapper together with the data structure.
+ *
+ * @param[in] sync Double pointer to the wrapper.
+ */
+void ds_sync_delete(ds_sync_t **sync);
+
+/**
+ * @brief Returns the wrapped data structure which may be used only between lock and unlock.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ * @return Pointer to the data structure.
+ */
+ds_t *ds_sync_ds(const ds_sync_t *sync);
+
+/**
+ * @brief Acquires the lock exclusively.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ */
+void ds_sync_lock(ds_sync_t *sync);
+
+/**
+ * @brief Releases the lock acquired by `ds_sync_lock`.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ */
+void ds_sync_unlock(ds_sync_t *sync);
+
+/**
+ * @brief Acquires the lock for reading, shared with other readers if the lock is `DS_LOCK_RWLOCK`.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ */
+void ds_sync_lock_shared(ds_sync_t *sync);
+
+/**
+ * @brief Releases the lock acquired by `ds_sync_lock_shared`.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ */
+void ds_sync_unlock_shared(ds_sync_t *sync);
+
+/**
+ * @brief Pushes or adds the element.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ * @param[in] data Pointer to the element.
+ * @return true if the operation was successful, false if the data structure is full.
+ */
+bool ds_sync_put(ds_sync_t *sync, const void *data);
+
+/**
+ * @brief Pops or retrieves the element.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ * @param[out] data Pointer to the buffer for the element.
+ * @return true if the operation was successful, false if the data structure is empty.
+ */
+bool ds_sync_take(ds_sync_t *sync, void *data);
+
+/**
+ * @brief Copies the element which would be taken next without removing it, under the shared lock.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ * @param[out] data Pointer to the buffer for the element.
+ * @return true if the operation was successful, false if the data structure is empty.
+ */
+bool ds_sync_peek(ds_sync_t *sync, void *data);
+
+/**
+ * @brief Returns the number of elements, under the shared lock.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ * @return Number of elements.
+ */
+size_t ds_sync_size(ds_sync_t *sync);
+
+/**
+ * @brief Puts the array of elements under the single acquisition of the lock.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ * @param[in] data Pointer to the elements.
+ * @param[in] count Number of the elements.
+ * @return Number of the put elements, less than `count` if the data structure became full.
+ */
+size_t ds_sync_put_batch(ds_sync_t *sync, const void *data, size_t count);
+
+/**
+ * @brief Takes up to `count` elements under the single acquisition of the lock.
+ *
+ * @param[in] sync Pointer to the wrapper.
+ * @param[out] data Pointer to the buffer for `count` elements.
+ * @param[in] count Max number of the elements.
+ * @return Number of the taken elements, less than `count` if the data structure became empty.
+ */
+size_t ds_sync_take_batch(ds_sync_t *sync, void *data, size_t count);
@@ -14,16 +14,155 @@
 #include <string.h>
 
 #include "common/uc_assert.h"
+#include "structs/ds_assert.h"
+#include "structs/ds_copy.h"
 #include "interface/allocator_if.h"
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Node of the list which stores elements of the queue.
+ */
+typedef struct QueueNode_t
+{
+  struct QueueNode_t *next; /**< Next node towards the end of the queue */
+  uint8_t data[];           /**< Element */
+} qnode_t;
+
 typedef struct
 {
-  size_t capacity;
+  size_t capacity;                   /**< Max number of elements or 0 if the queue is unlimited */
+  size_t esize;                      /**< Size in bytes of the single element */
+  size_t count;                      /**< Current number of elements */
+  qnode_t *head;                     /**< First node which would be retrieved by `queue_get` */
+  qnode_t *tail;                     /**< Last added node */
+  ds_copy_fn_t copy;                 /**< Copy kernel for the size of element */
+  size_t reserved;                   /**< Number of reserved credits */
+  size_t high;                       /**< High watermark of the load or 0 if the watermarks are disabled */
+  size_t low;                        /**< Low watermark of the load */
+  bool pressure;                     /**< Load has reached the high watermark and hasn't fallen to the low one */
+  queue_watermark_fn_t on_watermark; /**< Callback of the change of the pressure or NULL */
+  void *ctx;                         /**< User context of the callback */
+  void *block;                       /**< Allocated block which contains the queue at the boundary of the cache line */
 } qmeta_t;
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Frees all nodes of the queue.
+ */
+static void free_nodes(qmeta_t *meta)
+{
+  free_fn_t mem_free = get_free();
+
+  qnode_t *node = meta->head;
+  while (NULL != node)
+  {
+    qnode_t *next = node->next;
+    mem_free(node);
+    node = next;
+  }
+
+  meta->head = meta->tail = NULL;
+  meta->count = 0;
+}
+
+/**
+ * \brief Updates the pressure after the change of the load of the queue and calls the callback on its change.
+ */
+static void check_watermarks(const queue_t *queue, qmeta_t *meta)
+{
+  if (0 == meta->high)
+  {
+    return;
+  }
+
+  size_t load = meta->count + meta->reserved;
+  bool pressure = meta->pressure ? load > meta->low : load >= meta->high;
+  if (pressure == meta->pressure)
+  {
+    return;
+  }
+
+  meta->pressure = pressure;
+  if (NULL != meta->on_watermark)
+  {
+    meta->on_watermark(queue, pressure, meta->ctx);
+  }
+}
+
+/**
+ * \brief Links the node with the element to the tail of the queue.
+ */
+static bool link_element(qmeta_t *meta, const void *data)
+{
+  allocate_fn_t mem_allocate = get_allocator();
+
+  qnode_t *node = (qnode_t *)mem_allocate(sizeof(qnode_t) + meta->esize);
+  if (NULL == node)
+  {
+    return false;
+  }
+
+  meta->copy(node->data, data, meta->esize);
+  node->next = NULL;
+
+  if (NULL == meta->tail)
+  {
+    meta->head = node;
+  }
+  else
+  {
+    meta->tail->next = node;
+  }
+
+  meta->tail = node;
+  meta->count++;
+
+  return true;
+}
+
+/**
+ * \brief Returns size of the single element of the queue for `ds_t` interface.
+ */
+static size_t ds_esize(const ds_t *ds)
+{
+  return ((const qmeta_t *)ds->meta)->esize;
+}
+
+/**
+ * \brief Returns elements of the queue node by node from the head to the tail for `ds_t` interface.
+ */
+static bool ds_next_span(const ds_t *ds, void **pos, ds_span_t *span)
+{
+  const qmeta_t *meta = (const qmeta_t *)ds->meta;
+
+  qnode_t *node = (NULL == *pos) ? meta->head : ((qnode_t *)*pos)->next;
+  if (NULL == node)
+  {
+    return false;
+  }
+
+  span->data = node->data;
+  span->count = 1;
+  *pos = node;
+
+  return true;
+}
+
+/**
+ * \brief Returns max number of elements of the queue for `ds_t` interface.
+ */
+static size_t ds_capacity(const ds_t *ds)
+{
+  return ((const qmeta_t *)ds->meta)->capacity;
+}
+
+static const ds_iface_t queue_iface = {
+  .esize = ds_esize,
+  .next_span = ds_next_span,
+  .capacity = ds_capacity,
+  .kind = DS_KIND_QUEUE,
+};
 //_____ P U B L I C  F U N C T I O N S_________________________________________
 /**
  * \brief Initializes and returns a new queue
@@ -40,31 +179,33 @@ queue_t *queue_create(size_t size, size_t esize)
   }
 
   allocate_fn_t mem_allocate = get_allocator();
-  free_fn_t mem_free = get_free();
 
-  queue_t *queue = (queue_t *)mem_allocate(sizeof(queue_t));
-  if (NULL == queue)
+  // The handle and the meta take whole cache lines, so the queues wrapped for different threads don't share lines
+  size_t bytes = (sizeof(queue_t) + sizeof(qmeta_t) + QUEUE_CACHE_LINE - 1) & ~(size_t)(QUEUE_CACHE_LINE - 1);
+  void *block = mem_allocate(bytes + QUEUE_CACHE_LINE - 1);
+  if (NULL == block)
   {
     return NULL;
   }
 
-  queue->container = container_create(esize, CONTAINER_LINKED_LIST_BASED);
-  if (NULL == queue->container)
-  {
-    mem_free(queue);
-    return NULL;
-  }
-
-  queue->meta = (void *)mem_allocate(sizeof(qmeta_t));
-  if (NULL == queue->meta)
-  {
-    container_delete(&queue->container);
-    mem_free(queue);
-    return NULL;
-  }
+  queue_t *queue = (queue_t *)(((uintptr_t)block + QUEUE_CACHE_LINE - 1) & ~(uintptr_t)(QUEUE_CACHE_LINE - 1));
+  queue->meta = (void *)((uint8_t *)queue + sizeof(queue_t));
+  queue->iface = &queue_iface;
 
   qmeta_t *meta = (qmeta_t *)queue->meta;
+  meta->block = block;
   meta->capacity = size;
+  meta->esize = esize;
+  meta->count = 0;
+  meta->head = NULL;
+  meta->tail = NULL;
+  meta->copy = ds_copy_select(esize);
+  meta->reserved = 0;
+  meta->high = 0;
+  meta->low = 0;
+  meta->pressure = false;
+  meta->on_watermark = NULL;
+  meta->ctx = NULL;
 
   return queue;
 }
@@ -78,14 +219,13 @@ void queue_delete(queue_t **queue)
 {
   UC_ASSERT(queue);
   UC_ASSERT(*queue);
-  UC_ASSERT((*queue)->container);
   UC_ASSERT((*queue)->meta);
 
   free_fn_t mem_free = get_free();
 
-  container_delete(&((*queue)->container));
-  mem_free(((*queue)->meta));
-  mem_free(*queue);
+  qmeta_t *meta = (qmeta_t *)(*queue)->meta;
+  free_nodes(meta);
+  mem_free(meta->block);
   *queue = NULL;
 }
 
@@ -96,10 +236,10 @@ void queue_delete(queue_t **queue)
  */
 bool queue_empty(const queue_t *queue)
 {
-  UC_ASSERT(queue);
-  UC_ASSERT(queue->container);
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_PARANOID(queue->meta);
 
-  return (container_size(queue->container) == 0);
+  return (((const qmeta_t *)queue->meta)->count == 0);
 }
 
 /**
@@ -109,11 +249,11 @@ bool queue_empty(const queue_t *queue)
  */
 bool queue_full(const queue_t *queue)
 {
-  UC_ASSERT(queue);
-  UC_ASSERT(queue->container);
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_PARANOID(queue->meta);
 
-  size_t size = ((qmeta_t *)queue->meta)->capacity;
-  return (size != 0) ? container_size(queue->container) == size : false;
+  const qmeta_t *meta = (const qmeta_t *)queue->meta;
+  return (meta->capacity != 0) ? meta->count + meta->reserved >= meta->capacity : false;
 }
 
 /**
@@ -123,11 +263,20 @@ bool queue_full(const queue_t *queue)
  */
 bool queue_add(queue_t *queue, const void *data)
 {
-  UC_ASSERT(queue);
-  UC_ASSERT(data);
-  UC_ASSERT(queue->container);
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  qmeta_t *meta = (qmeta_t *)queue->meta;
 
-  return (!queue_full(queue)) ? container_push_back(queue->container, data) : false;
+  if (queue_full(queue) || !link_element(meta, data))
+  {
+    return false;
+  }
+
+  check_watermarks(queue, meta);
+
+  return true;
 }
 
 /**
@@ -137,11 +286,34 @@ bool queue_add(queue_t *queue, const void *data)
  */
 bool queue_get(queue_t *queue, void *data)
 {
-  UC_ASSERT(NULL != queue);
-  UC_ASSERT(NULL != data);
-  UC_ASSERT(queue->container);
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_CHEAP(NULL != data);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  qmeta_t *meta = (qmeta_t *)queue->meta;
+  qnode_t *node = meta->head;
+
+  if (NULL == node)
+  {
+    return false;
+  }
+
+  meta->copy(data, node->data, meta->esize);
 
-  return container_pop_front(queue->container, data);
+  meta->head = node->next;
+  if (NULL == meta->head)
+  {
+    meta->tail = NULL;
+  }
+
+  meta->count--;
+
+  free_fn_t mem_free = get_free();
+  mem_free(node);
+
+  check_watermarks(queue, meta);
+
+  return true;
 }
 
 /**
@@ -151,11 +323,20 @@ bool queue_get(queue_t *queue, void *data)
  */
 bool queue_peek(const queue_t *queue, void *data)
 {
-  UC_ASSERT(NULL != queue);
-  UC_ASSERT(NULL != data);
-  UC_ASSERT(queue->container);
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_CHEAP(NULL != data);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  const qmeta_t *meta = (const qmeta_t *)queue->meta;
+
+  if (NULL == meta->head)
+  {
+    return false;
+  }
 
-  return container_at(queue->container, data, 0);
+  meta->copy(data, meta->head->data, meta->esize);
+
+  return true;
 }
 
 /**
@@ -165,10 +346,10 @@ bool queue_peek(const queue_t *queue, void *data)
  */
 size_t queue_size(const queue_t *queue)
 {
-  UC_ASSERT(NULL != queue);
-  UC_ASSERT(queue->container);
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_PARANOID(queue->meta);
 
-  return container_size(queue->container);
+  return ((const qmeta_t *)queue->meta)->count;
 }
 
 /**
@@ -178,8 +359,137 @@ size_t queue_size(const queue_t *queue)
  */
 bool queue_clear(queue_t *queue)
 {
-  UC_ASSERT(NULL != queue);
-  UC_ASSERT(queue->container);
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  qmeta_t *meta = (qmeta_t *)queue->meta;
+  free_nodes(meta);
+  check_watermarks(queue, meta);
+
+  return true;
+}
+
+/**
+ * Sets the watermarks of the queue load.
+ *
+ * Detailed description see in queue.h
+ */
+bool queue_set_watermarks(queue_t *queue, size_t high, size_t low, queue_watermark_fn_t callback, void *ctx)
+{
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  qmeta_t *meta = (qmeta_t *)queue->meta;
+
+  if (0 != high && (low >= high || (0 != meta->capacity && high > meta->capacity)))
+  {
+    return false;
+  }
+
+  meta->high = high;
+  meta->low = low;
+  meta->on_watermark = callback;
+  meta->ctx = ctx;
+
+  // The current load is evaluated against the new watermarks without calling back
+  size_t load = meta->count + meta->reserved;
+  meta->pressure = (0 != high) && load >= high;
+
+  return true;
+}
+
+/**
+ * Checks if the queue is under pressure.
+ *
+ * Detailed description see in queue.h
+ */
+bool queue_pressure(const queue_t *queue)
+{
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  return ((const qmeta_t *)queue->meta)->pressure;
+}
+
+/**
+ * Reserves the room for `count` elements.
+ *
+ * Detailed description see in queue.h
+ */
+bool queue_reserve(queue_t *queue, size_t count)
+{
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  qmeta_t *meta = (qmeta_t *)queue->meta;
+
+  if (0 != meta->capacity && count > meta->capacity - meta->count - meta->reserved)
+  {
+    return false;
+  }
+
+  meta->reserved += count;
+  check_watermarks(queue, meta);
+
+  return true;
+}
+
+/**
+ * Adds an element to the queue, spending one reserved credit.
+ *
+ * Detailed description see in queue.h
+ */
+bool queue_add_reserved(queue_t *queue, const void *data)
+{
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_CHEAP(NULL != data);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  qmeta_t *meta = (qmeta_t *)queue->meta;
+
+  if (0 == meta->reserved || !link_element(meta, data))
+  {
+    return false;
+  }
+
+  // The load doesn't change: the credit turns into the element
+  meta->reserved--;
+
+  return true;
+}
+
+/**
+ * Gives back the unspent credits.
+ *
+ * Detailed description see in queue.h
+ */
+bool queue_release(queue_t *queue, size_t count)
+{
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  qmeta_t *meta = (qmeta_t *)queue->meta;
+
+  if (count > meta->reserved)
+  {
+    return false;
+  }
+
+  meta->reserved -= count;
+  check_watermarks(queue, meta);
+
+  return true;
+}
+
+/**
+ * Returns the number of the reserved credits.
+ *
+ * Detailed description see in queue.h
+ */
+size_t queue_reserved(const queue_t *queue)
+{
+  DS_ASSERT_CHEAP(NULL != queue);
+  DS_ASSERT_PARANOID(queue->meta);
 
-  return container_clear(queue->container);
+  return ((const qmeta_t *)queue->meta)->reserved;
 }
@@ -8,15 +8,27 @@
 #pragma once
 
 //_____ I N C L U D E S _______________________________________________________
-#include "core/container.h"
 #include "structs/ds.h"
 
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 //_____ C O N F I G S  ________________________________________________________
+/** Size of the cache line which the handle and the meta of the queue occupy exclusively */
+#ifndef QUEUE_CACHE_LINE
+  #define QUEUE_CACHE_LINE 64U
+#endif
 //_____ D E F I N I T I O N S _________________________________________________
 typedef ds_t queue_t;
+
+/**
+ * \brief Function called when the queue crosses its watermarks.
+ *
+ * \param[in] queue Pointer to the queue. The function mustn't change the queue.
+ * \param[in] high true if the queue has reached the high watermark, false if it has fallen to the low one.
+ * \param[in] ctx User context passed to `queue_set_watermarks`.
+ */
+typedef void (*queue_watermark_fn_t)(const queue_t *queue, bool high, void *ctx);
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P U B L I C  F U N C T I O N S_________________________________________
@@ -48,7 +60,7 @@ void queue_delete(queue_t **queue);
 bool queue_empty(const queue_t *queue);
 
 /**
- * \brief Checks if the queue is full.
+ * \brief Checks if the queue is full. The reserved credits take their room (see `queue_reserve`).
  *
  * \param[in] queue Pointer to the queue.
  * \return true if the queue is full, false otherwise.
@@ -97,3 +109,68 @@ size_t queue_size(const queue_t *queue);
  * \return true if the operation was successful, false otherwise.
  */
 bool queue_clear(queue_t *queue);
+
+/**
+ * \brief Sets the watermarks of the queue load which is the number of elements plus the reserved credits.
+ *
+ * The queue comes under pressure when its load reaches `high` and leaves it only when the load falls to `low`, so
+ * the producers throttled at the high watermark are not released by the first retrieved element. The callback
+ * is called on every change of the pressure from the function which changed the load.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] high High watermark, 0 disables the watermarks.
+ * \param[in] low Low watermark, less than `high`.
+ * \param[in] callback Function called on the change of the pressure or NULL to poll `queue_pressure`.
+ * \param[in] ctx User context passed to the callback.
+ * \return true if the operation was successful, false if the watermarks are inconsistent or `high` exceeds the
+ *         capacity of the limited queue.
+ */
+bool queue_set_watermarks(queue_t *queue, size_t high, size_t low, queue_watermark_fn_t callback, void *ctx);
+
+/**
+ * \brief Checks if the queue is under pressure: its load has reached the high watermark and hasn't fallen to the
+ *        low one since then.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \return true if the queue is under pressure, false otherwise or if the watermarks are disabled.
+ */
+bool queue_pressure(const queue_t *queue);
+
+/**
+ * \brief Reserves the room for `count` elements which may then be added by `queue_add_reserved` only.
+ *
+ * The reserved room is taken from the capacity available to `queue_add`, so the producer which got the credits
+ * for the whole batch never fails in the middle of it because of other producers.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] count Number of credits.
+ * \return true if all credits are granted, false if there is no room for all of them, nothing is reserved then.
+ */
+bool queue_reserve(queue_t *queue, size_t count);
+
+/**
+ * \brief Adds an element to the queue, spending one reserved credit.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] data Pointer to the variable to be enqueued.
+ * \return true if the operation was successful, false if there are no credits or no memory.
+ */
+bool queue_add_reserved(queue_t *queue, const void *data);
+
+/**
+ * \brief Gives back the unspent credits.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] count Number of credits.
+ * \return true if the operation was successful, false if `count` is more than `queue_reserved`, then no credits
+ *         are given back.
+ */
+bool queue_release(queue_t *queue, size_t count);
+
+/**
+ * \brief Returns the number of the reserved credits which aren't spent yet.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \return Number of credits.
+ */
+size_t queue_reserved(const queue_t *queue);
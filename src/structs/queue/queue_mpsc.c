@@ -0,0 +1,255 @@
+/**
+ * \file    queue_mpsc.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Unbounded lock-free queue with multiple producers and single consumer.
+ * \date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "queue_mpsc.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "structs/ds_assert.h"
+#include "structs/ds_copy.h"
+#include "structs/ds_pool.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Size of the cache line which separates the head written by the producers and the tail of the consumer */
+#ifndef QUEUE_MPSC_CACHE_LINE
+  #define QUEUE_MPSC_CACHE_LINE 64U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Node of the list. The element of the tail node is already retrieved, it serves as the stub.
+ */
+typedef struct MpscNode_t
+{
+  _Atomic(struct MpscNode_t *) next; /**< Next node towards the head of the list */
+  uint8_t data[];                     /**< Element */
+} mpsc_node_t;
+
+typedef struct
+{
+  _Atomic(mpsc_node_t *) head; /**< Last added node, exchanged by the producers */
+  uint8_t pad0[QUEUE_MPSC_CACHE_LINE - sizeof(void *)];
+  mpsc_node_t *tail;           /**< Stub node, the next one holds the oldest element */
+  size_t esize;                /**< Size in bytes of the single element */
+  ds_copy_fn_t copy;           /**< Copy kernel for the size of element */
+  ds_pool_t *pool;             /**< Pool of the nodes */
+} mpsc_meta_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Returns size of the single element of the queue for `ds_t` interface.
+ */
+static size_t ds_esize(const ds_t *ds)
+{
+  return ((const mpsc_meta_t *)ds->meta)->esize;
+}
+
+/**
+ * \brief Returns elements of the queue node by node from the oldest one for `ds_t` interface.
+ */
+static bool ds_next_span(const ds_t *ds, void **pos, ds_span_t *span)
+{
+  const mpsc_meta_t *meta = (const mpsc_meta_t *)ds->meta;
+
+  mpsc_node_t *node = (NULL == *pos) ? meta->tail : (mpsc_node_t *)*pos;
+  node = atomic_load_explicit(&node->next, memory_order_acquire);
+  if (NULL == node)
+  {
+    return false;
+  }
+
+  span->data = node->data;
+  span->count = 1;
+  *pos = node;
+
+  return true;
+}
+
+/**
+ * \brief Returns 0 for `ds_t` interface, the queue is unlimited.
+ */
+static size_t ds_capacity(const ds_t *ds)
+{
+  (void)ds;
+  return 0;
+}
+
+static const ds_iface_t queue_mpsc_iface = {
+  .esize = ds_esize,
+  .next_span = ds_next_span,
+  .capacity = ds_capacity,
+  .kind = DS_KIND_QUEUE_MPSC,
+};
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * Initializes and returns a new queue for multiple producers and single consumer.
+ *
+ * Detailed description see in queue_mpsc.h
+ */
+queue_mpsc_t *queue_mpsc_create(size_t esize)
+{
+  UC_ASSERT(0 != esize);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  queue_mpsc_t *queue = (queue_mpsc_t *)mem_allocate(sizeof(queue_mpsc_t) + sizeof(mpsc_meta_t));
+  if (NULL == queue)
+  {
+    return NULL;
+  }
+
+  ds_pool_t *pool = ds_pool_create(sizeof(mpsc_node_t) + esize, QUEUE_MPSC_SLAB);
+  mpsc_node_t *stub = (NULL != pool) ? (mpsc_node_t *)ds_pool_alloc(pool) : NULL;
+  if (NULL == stub)
+  {
+    if (NULL != pool)
+    {
+      ds_pool_delete(&pool);
+    }
+    mem_free(queue);
+    return NULL;
+  }
+
+  atomic_init(&stub->next, NULL);
+
+  queue->meta = (void *)((uint8_t *)queue + sizeof(queue_mpsc_t));
+  queue->iface = &queue_mpsc_iface;
+
+  mpsc_meta_t *meta = (mpsc_meta_t *)queue->meta;
+  atomic_init(&meta->head, stub);
+  meta->tail = stub;
+  meta->esize = esize;
+  meta->copy = ds_copy_select(esize);
+  meta->pool = pool;
+
+  return queue;
+}
+
+/**
+ * Frees up the memory associated with the queue.
+ *
+ * Detailed description see in queue_mpsc.h
+ */
+void queue_mpsc_delete(queue_mpsc_t **queue)
+{
+  UC_ASSERT(queue);
+  UC_ASSERT(*queue);
+  UC_ASSERT((*queue)->meta);
+
+  free_fn_t mem_free = get_free();
+
+  // The nodes are freed together with the slabs of the pool
+  ds_pool_delete(&((mpsc_meta_t *)(*queue)->meta)->pool);
+  mem_free(*queue);
+  *queue = NULL;
+}
+
+/**
+ * Adds an element to the queue.
+ *
+ * Detailed description see in queue_mpsc.h
+ */
+bool queue_mpsc_add(queue_mpsc_t *queue, const void *data)
+{
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  mpsc_meta_t *meta = (mpsc_meta_t *)queue->meta;
+
+  mpsc_node_t *node = (mpsc_node_t *)ds_pool_alloc(meta->pool);
+  if (NULL == node)
+  {
+    return false;
+  }
+
+  meta->copy(node->data, data, meta->esize);
+  atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+
+  mpsc_node_t *prev = atomic_exchange_explicit(&meta->head, node, memory_order_acq_rel);
+  atomic_store_explicit(&prev->next, node, memory_order_release);
+
+  return true;
+}
+
+/**
+ * Removes an element from the queue and returns it.
+ *
+ * Detailed description see in queue_mpsc.h
+ */
+bool queue_mpsc_get(queue_mpsc_t *queue, void *data)
+{
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  mpsc_meta_t *meta = (mpsc_meta_t *)queue->meta;
+  mpsc_node_t *stub = meta->tail;
+
+  mpsc_node_t *next = atomic_load_explicit(&stub->next, memory_order_acquire);
+  if (NULL == next)
+  {
+    return false;
+  }
+
+  // The node of the retrieved element becomes the new stub
+  meta->copy(data, next->data, meta->esize);
+  meta->tail = next;
+  ds_pool_free(meta->pool, stub);
+
+  return true;
+}
+
+/**
+ * Retrieves the element from the queue without removing it.
+ *
+ * Detailed description see in queue_mpsc.h
+ */
+bool queue_mpsc_peek(const queue_mpsc_t *queue, void *data)
+{
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  const mpsc_meta_t *meta = (const mpsc_meta_t *)queue->meta;
+
+  mpsc_node_t *next = atomic_load_explicit(&meta->tail->next, memory_order_acquire);
+  if (NULL == next)
+  {
+    return false;
+  }
+
+  meta->copy(data, next->data, meta->esize);
+
+  return true;
+}
+
+/**
+ * Checks if the queue has no linked elements.
+ *
+ * Detailed description see in queue_mpsc.h
+ */
+bool queue_mpsc_empty(const queue_mpsc_t *queue)
+{
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_PARANOID(queue->meta);
+
+  const mpsc_meta_t *meta = (const mpsc_meta_t *)queue->meta;
+
+  return NULL == atomic_load_explicit(&meta->tail->next, memory_order_acquire);
+}
@@ -0,0 +1,89 @@
+/**
+ * \file    queue_mpsc.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Unbounded lock-free queue with multiple producers and single consumer.
+ * \date    2026-10-18
+ *
+ * The queue is the list of nodes with the stub node at the tail (D. Vyukov's non-intrusive MPSC queue). The
+ * producer links the node by one atomic exchange of the head; the consumer moves the tail without atomic
+ * read-modify-write operations. The nodes are taken from and returned to the lock-free pool (see ds_pool.h), so
+ * the steady flow of elements doesn't call the allocator.
+ *
+ * The producers are lock-free, not wait-free: taking the node from the pool is the CAS loop which may retry while
+ * other threads take or return nodes, and the producer which finds the pool empty calls the allocator to grow it.
+ *
+ * The producer which exchanged the head but didn't link the previous node yet hides the elements added after
+ * its element, so `queue_mpsc_get` may return false for a moment while the queue isn't empty.
+ *
+ * The queue supports `ds_t` interface, which may be used only by the consumer while there are no producers,
+ * e.g. to save the snapshot. The snapshot is restored as the ordinary unlimited queue.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include "structs/ds.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Number of nodes allocated at once when the pool of the queue is exhausted */
+#ifndef QUEUE_MPSC_SLAB
+  #define QUEUE_MPSC_SLAB 256U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+typedef ds_t queue_mpsc_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Initializes and returns a new unbounded queue for multiple producers and single consumer.
+ *
+ * \param[in] esize The size in bytes of the single element that this queue will store.
+ *
+ * \return Pointer to the newly created queue or NULL.
+ */
+queue_mpsc_t *queue_mpsc_create(size_t esize);
+
+/**
+ * \brief Frees up the memory associated with the queue. There must be no producers and no consumer.
+ *
+ * \param[in] queue Double pointer to the queue to be deleted.
+ */
+void queue_mpsc_delete(queue_mpsc_t **queue);
+
+/**
+ * \brief Adds an element to the queue. May be called by any number of threads concurrently.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] data Pointer to the variable to be enqueued.
+ * \return true if the operation was successful, false if there is no memory for the node.
+ */
+bool queue_mpsc_add(queue_mpsc_t *queue, const void *data);
+
+/**
+ * \brief Removes an element from the queue and returns it. May be called only by the consumer thread.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[out] data Pointer to a variable where the dequeued element will be stored.
+ * \return true if the operation was successful, false if there are no linked elements.
+ */
+bool queue_mpsc_get(queue_mpsc_t *queue, void *data);
+
+/**
+ * \brief Retrieves the element from the queue without removing it. May be called only by the consumer thread.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[out] data Pointer to a variable where the peeked element will be stored.
+ * \return true if the operation was successful, false if there are no linked elements.
+ */
+bool queue_mpsc_peek(const queue_mpsc_t *queue, void *data);
+
+/**
+ * \brief Checks if the queue has no linked elements. May be called only by the consumer thread.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \return true if the queue is empty, false otherwise.
+ */
+bool queue_mpsc_empty(const queue_mpsc_t *queue);
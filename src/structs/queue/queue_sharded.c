@@ -0,0 +1,298 @@
+/**
+ * \file    queue_sharded.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Queue split into shards for many producers and consumers with stealing of elements.
+ * \date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "queue_sharded.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "structs/ds_assert.h"
+#include "structs/queue/queue.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Shard of the queue occupying its own cache line.
+ */
+typedef struct
+{
+  _Alignas(QUEUE_SHARDED_CACHE_LINE) ds_sync_t *sync; /**< Queue of the shard with its lock */
+  atomic_size_t count; /**< Number of elements, changed under the lock and read without it */
+} shard_t;
+
+struct QueueSharded_t
+{
+  size_t shards;  /**< Number of shards */
+  size_t esize;   /**< Size in bytes of the single element */
+  shard_t *shard; /**< Shards placed in the same memory block at the first boundary of the cache line */
+};
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+/** Number of threads which asked for their shard */
+static atomic_size_t threads = 0;
+
+/** Ordinal number of the calling thread or SIZE_MAX if it isn't assigned yet */
+static _Thread_local size_t ordinal = SIZE_MAX;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Removes up to `count` elements from the shard under one lock.
+ */
+static size_t take(shard_t *shard, size_t esize, void *data, size_t count)
+{
+  queue_t *queue = ds_sync_ds(shard->sync);
+  size_t taken = 0;
+
+  ds_sync_lock(shard->sync);
+  while (taken < count && queue_get(queue, (uint8_t *)data + taken * esize))
+  {
+    taken++;
+  }
+  atomic_fetch_sub_explicit(&shard->count, taken, memory_order_relaxed);
+  ds_sync_unlock(shard->sync);
+
+  return taken;
+}
+
+/**
+ * \brief Removes elements from the first non-empty shard after the shard of the consumer.
+ *
+ * \param[in] portion Max part of the elements of the victim taken at once: 1 is all, 2 is half etc.
+ */
+static size_t steal(queue_sharded_t *queue, size_t shard, void *data, size_t count, size_t portion)
+{
+  for (size_t i = 1; i < queue->shards; i++)
+  {
+    shard_t *victim = &queue->shard[(shard + i) % queue->shards];
+
+    // The empty shards are skipped without taking their locks
+    size_t available = atomic_load_explicit(&victim->count, memory_order_relaxed);
+    if (0 == available)
+    {
+      continue;
+    }
+
+    available = (available + portion - 1) / portion;
+    size_t taken = take(victim, queue->esize, data, (available < count) ? available : count);
+    if (0 != taken)
+    {
+      return taken;
+    }
+  }
+
+  return 0;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * Initializes and returns a new sharded queue.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+queue_sharded_t *queue_sharded_create(size_t shards, size_t size, size_t esize, ds_lock_t lock)
+{
+  UC_ASSERT(0 != shards);
+  UC_ASSERT(0 != esize);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+
+  // The allocator gives no alignment to the cache line, so the shards are shifted to the boundary inside the block
+  queue_sharded_t *queue =
+    (queue_sharded_t *)mem_allocate(sizeof(queue_sharded_t) + QUEUE_SHARDED_CACHE_LINE - 1 + shards * sizeof(shard_t));
+  if (NULL == queue)
+  {
+    return NULL;
+  }
+
+  uintptr_t shard = (uintptr_t)queue + sizeof(queue_sharded_t);
+  queue->shard = (shard_t *)((shard + QUEUE_SHARDED_CACHE_LINE - 1) & ~(uintptr_t)(QUEUE_SHARDED_CACHE_LINE - 1));
+  queue->shards = shards;
+  queue->esize = esize;
+
+  for (size_t i = 0; i < shards; i++)
+  {
+    queue_t *shard = queue_create(size, esize);
+    queue->shard[i].sync = ds_sync_create(shard, lock);
+    atomic_init(&queue->shard[i].count, 0);
+
+    if (NULL == queue->shard[i].sync)
+    {
+      if (NULL != shard)
+      {
+        queue_delete(&shard);
+      }
+      queue->shards = i;
+      queue_sharded_delete(&queue);
+      return NULL;
+    }
+  }
+
+  return queue;
+}
+
+/**
+ * Frees up the memory associated with the queue.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+void queue_sharded_delete(queue_sharded_t **queue)
+{
+  UC_ASSERT(queue);
+  UC_ASSERT(*queue);
+
+  free_fn_t mem_free = get_free();
+
+  for (size_t i = 0; i < (*queue)->shards; i++)
+  {
+    ds_sync_delete(&(*queue)->shard[i].sync);
+  }
+
+  mem_free(*queue);
+  *queue = NULL;
+}
+
+/**
+ * Returns the number of shards of the queue.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+size_t queue_sharded_shards(const queue_sharded_t *queue)
+{
+  DS_ASSERT_CHEAP(queue);
+
+  return queue->shards;
+}
+
+/**
+ * Returns the shard of the calling thread.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+size_t queue_sharded_home(const queue_sharded_t *queue)
+{
+  DS_ASSERT_CHEAP(queue);
+
+  if (SIZE_MAX == ordinal)
+  {
+    ordinal = atomic_fetch_add_explicit(&threads, 1, memory_order_relaxed);
+  }
+
+  return ordinal % queue->shards;
+}
+
+/**
+ * Adds an element to the shard of the queue.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+bool queue_sharded_add(queue_sharded_t *queue, size_t shard, const void *data)
+{
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_CHEAP(shard < queue->shards);
+
+  shard_t *home = &queue->shard[shard];
+
+  ds_sync_lock(home->sync);
+  bool status = queue_add(ds_sync_ds(home->sync), data);
+  if (status)
+  {
+    atomic_fetch_add_explicit(&home->count, 1, memory_order_relaxed);
+  }
+  ds_sync_unlock(home->sync);
+
+  return status;
+}
+
+/**
+ * Removes an element from the shard of the consumer or from any other shard.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+bool queue_sharded_get(queue_sharded_t *queue, size_t shard, void *data)
+{
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_CHEAP(shard < queue->shards);
+
+  shard_t *home = &queue->shard[shard];
+
+  if (0 != atomic_load_explicit(&home->count, memory_order_relaxed) && 0 != take(home, queue->esize, data, 1))
+  {
+    return true;
+  }
+
+  return 0 != steal(queue, shard, data, 1, 1);
+}
+
+/**
+ * Removes up to `count` elements from one shard.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+size_t queue_sharded_get_batch(queue_sharded_t *queue, size_t shard, void *data, size_t count)
+{
+  DS_ASSERT_CHEAP(queue);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_CHEAP(shard < queue->shards);
+
+  if (0 == count)
+  {
+    return 0;
+  }
+
+  shard_t *home = &queue->shard[shard];
+
+  if (0 != atomic_load_explicit(&home->count, memory_order_relaxed))
+  {
+    size_t taken = take(home, queue->esize, data, count);
+    if (0 != taken)
+    {
+      return taken;
+    }
+  }
+
+  // Half of the elements of the victim is left for its own consumer
+  return steal(queue, shard, data, count, 2);
+}
+
+/**
+ * Returns the number of elements in all shards.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+size_t queue_sharded_size(const queue_sharded_t *queue)
+{
+  DS_ASSERT_CHEAP(queue);
+
+  size_t size = 0;
+  for (size_t i = 0; i < queue->shards; i++)
+  {
+    size += atomic_load_explicit(&queue->shard[i].count, memory_order_relaxed);
+  }
+
+  return size;
+}
+
+/**
+ * Checks if all shards of the queue are empty.
+ *
+ * Detailed description see in queue_sharded.h
+ */
+bool queue_sharded_empty(const queue_sharded_t *queue)
+{
+  DS_ASSERT_CHEAP(queue);
+
+  return 0 == queue_sharded_size(queue);
+}
@@ -0,0 +1,123 @@
+/**
+ * \file    queue_sharded.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Queue split into shards for many producers and consumers with stealing of elements.
+ * \date    2026-10-18
+ *
+ * The queue keeps one ordinary queue per shard, each one guarded by its own lock (see ds_sync.h). The handle of
+ * the shard and the counter of its elements occupy their own cache line. The lock and the queue of the shard are
+ * allocated by the wrapper and the queue, each one at the boundary of the cache line and padded to whole lines,
+ * so the lock and the meta of one shard never share the line with another shard. The producer adds elements to
+ * the shard of its own, so the producers working with different shards never touch the same tail. The consumer
+ * takes elements from its own shard first and, when it is empty, steals them from the other shards, skipping the
+ * empty ones by their counters without taking the locks.
+ *
+ * The elements added to one shard are retrieved in the order of adding, so every producer which sticks to one
+ * shard keeps its FIFO order. There is no order between the elements of different shards. The shard of the
+ * calling thread is given by `queue_sharded_home`, which spreads the threads over the shards in the order of
+ * their first call, or may be chosen by the caller, e.g. by the number of the core.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include "structs/ds_sync.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Size of the cache line which separates the shards */
+#ifndef QUEUE_SHARDED_CACHE_LINE
+  #define QUEUE_SHARDED_CACHE_LINE 64U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct QueueSharded_t queue_sharded_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Initializes and returns a new sharded queue.
+ *
+ * \param[in] shards Number of shards, e.g. the number of producers or cores.
+ * \param[in] size The size in elements of every shard or 0 if you won`t limit size of shards.
+ * \param[in] esize The size in bytes of the single element that this queue will store.
+ * \param[in] lock Kind of the lock of every shard.
+ *
+ * \return Pointer to the newly created queue or NULL.
+ */
+queue_sharded_t *queue_sharded_create(size_t shards, size_t size, size_t esize, ds_lock_t lock);
+
+/**
+ * \brief Frees up the memory associated with the queue. There must be no other threads using the queue.
+ *
+ * \param[in] queue Double pointer to the queue to be deleted.
+ */
+void queue_sharded_delete(queue_sharded_t **queue);
+
+/**
+ * \brief Returns the number of shards of the queue.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \return Number of shards.
+ */
+size_t queue_sharded_shards(const queue_sharded_t *queue);
+
+/**
+ * \brief Returns the shard of the calling thread. The same thread always gets the same shard.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \return Index of the shard.
+ */
+size_t queue_sharded_home(const queue_sharded_t *queue);
+
+/**
+ * \brief Adds an element to the shard of the queue.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] shard Index of the shard of the producer.
+ * \param[in] data Pointer to the variable to be enqueued.
+ * \return true if the operation was successful, false if the shard is full or there is no memory. The element
+ *         isn't added to other shards, so the order of elements of the producer is kept.
+ */
+bool queue_sharded_add(queue_sharded_t *queue, size_t shard, const void *data);
+
+/**
+ * \brief Removes an element from the shard of the consumer or, if it is empty, from any other shard.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] shard Index of the shard of the consumer.
+ * \param[out] data Pointer to a variable where the dequeued element will be stored.
+ * \return true if the operation was successful, false if all shards are empty.
+ */
+bool queue_sharded_get(queue_sharded_t *queue, size_t shard, void *data);
+
+/**
+ * \brief Removes up to `count` elements from the shard of the consumer under one lock or, if it is empty, steals
+ *        up to half of the elements of the first non-empty shard.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \param[in] shard Index of the shard of the consumer.
+ * \param[out] data Pointer to the array of at least `count` elements.
+ * \param[in] count Max number of elements.
+ * \return Number of removed elements, all of them come from one shard in the order of adding.
+ */
+size_t queue_sharded_get_batch(queue_sharded_t *queue, size_t shard, void *data, size_t count);
+
+/**
+ * \brief Returns the number of elements in all shards. The result may be outdated at once if other threads use
+ *        the queue.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \return Number of elements.
+ */
+size_t queue_sharded_size(const queue_sharded_t *queue);
+
+/**
+ * \brief Checks if all shards of the queue are empty. The result may be outdated at once if other threads use
+ *        the queue.
+ *
+ * \param[in] queue Pointer to the queue.
+ * \return true if the queue is empty, false otherwise.
+ */
+bool queue_sharded_empty(const queue_sharded_t *queue);
@@ -0,0 +1,117 @@
+/**
+ * @file rb_private.h
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Meta of the ring buffer shared by the files which implement its kinds of storage. Private header.
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer.h"
+#include "structs/ds_copy.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 to build the library without the ring buffers placed in memory mapped files */
+#ifndef RB_USE_MMAP
+  #if defined(__unix__) || defined(__APPLE__)
+    #define RB_USE_MMAP 1
+  #else
+    #define RB_USE_MMAP 0
+  #endif
+#endif
+
+/** Size of the cache line which separates the indexes written by the producer and by the consumer */
+#ifndef RB_CACHE_LINE
+  #define RB_CACHE_LINE 64U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Kind of the storage of the ring buffer.
+ */
+typedef enum
+{
+  RB_STORAGE_HEAP = 0, /**< Meta, indexes and storage are placed in one heap block with `ring_buffer_t` */
+  RB_STORAGE_FILE,     /**< Indexes and storage are placed in the memory mapped file */
+  RB_STORAGE_SHARED,   /**< Indexes and storage are placed in the shared memory object */
+  RB_STORAGE_MIRRORED, /**< Storage is mapped twice back to back, so the spans never wrap */
+  RB_STORAGE_PAGES,    /**< Storage is mapped by `mem_pages_alloc` */
+} rb_storage_t;
+
+/**
+ * \brief Indexes of the ring buffer.
+ *
+ * The indexes are kept apart from the meta because the file backed and the shared ring buffers place them
+ * in the mapped memory, while the meta holds pointers which are valid only in the current process. The
+ * indexes written by the producer and by the consumer are placed in different cache lines.
+ */
+typedef struct
+{
+  atomic_size_t head;    /**< Index of the slot which would be filled by `rb_add` */
+  atomic_size_t reserve; /**< Number of slots reserved by multiple producers, modulo `max_size` is the next slot */
+  uint8_t pad0[RB_CACHE_LINE - 2 * sizeof(atomic_size_t)];
+  atomic_size_t tail;    /**< Index of the element which would be retrieved by `rb_get` */
+  uint8_t pad1[RB_CACHE_LINE - sizeof(atomic_size_t)];
+} rbindex_t;
+
+/**
+ * \brief Meta of the ring buffer.
+ */
+typedef struct
+{
+  rbindex_t *index;     /**< Indexes of the head and the tail */
+  size_t max_size;      /**< Number of slots in the storage */
+  size_t esize;         /**< Size in bytes of the single element */
+  rb_storage_t storage; /**< Kind of the storage */
+  rb_sync_t sync;       /**< Policy of flushing the changes of the file backed storage */
+  bool multi_producer;  /**< Elements are added by several threads or processes */
+  ds_copy_fn_t copy;    /**< Copy kernel for the size of element */
+  uint8_t *data;        /**< Storage of `max_size` slots */
+  void *mapping;        /**< Beginning of the mapped memory or NULL */
+  size_t mapped_size;   /**< Size in bytes of the mapped memory */
+  size_t io_head;       /**< Bytes of the element at the head already read by `rb_read_from_fd` */
+  size_t io_tail;       /**< Bytes of the element at the tail already written by `rb_write_to_fd` */
+} rbmeta_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+/** Implementation of `ds_t` interface shared by all kinds of storage */
+extern const ds_iface_t rb_iface;
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Initializes the meta of the heap ring buffer with the storage `data` of `size` slots.
+ */
+void rb_init_meta(rbmeta_t *meta, rbindex_t *index, size_t size, size_t esize, uint8_t *data);
+
+/**
+ * \brief Initializes the indexes of the empty ring buffer.
+ */
+void rb_init_index(rbindex_t *index);
+
+/**
+ * \brief Flushes `size` bytes of the mapped file starting from `addr` according to the sync policy.
+ */
+void rb_mapped_sync(const rbmeta_t *meta, const void *addr, size_t size);
+
+/**
+ * \brief Flushes all changes and unmaps the file. Frees `ring_buffer_t` itself.
+ */
+void rb_mapped_release(ring_buffer_t *rb);
+
+/**
+ * \brief Unmaps the shared memory object. Frees `ring_buffer_t` itself.
+ */
+void rb_shared_release(ring_buffer_t *rb);
+
+/**
+ * \brief Unmaps both views of the mirrored storage. Frees `ring_buffer_t` itself.
+ */
+void rb_mirrored_release(ring_buffer_t *rb);
+
+/**
+ * \brief Unmaps the storage mapped by `mem_pages_alloc`. Frees `ring_buffer_t` itself.
+ */
+void rb_pages_release(ring_buffer_t *rb);
@@ -8,6 +8,7 @@
 //_____ I N C L U D E S _______________________________________________________
 #include "ring_buffer.h"
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -15,84 +16,288 @@
 #include <string.h>
 
 #include "common/uc_assert.h"
-#include "core/container.h"
+#include "structs/ds_assert.h"
+#include "structs/ds_copy.h"
 #include "interface/allocator_if.h"
+#include "rb_private.h"
+
+#if RB_USE_MMAP
+  #include <sched.h>
+#endif
 
 //_____ C O N F I G S  ________________________________________________________
+/** Number of checks of the head after which the waiting producer yields the processor */
+#ifndef RB_SPIN_LIMIT
+  #define RB_SPIN_LIMIT 64U
+#endif
 //_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
 /**
- *  \brief
+ * \brief Joins the spans of the mirrored storage: the slots after the end of the storage map its beginning.
  */
-typedef struct
+static inline void merge_mirrored(const rbmeta_t *meta, ds_span_t *first, ds_span_t *second)
 {
-  volatile size_t tail;
-  volatile size_t head;
-  size_t max_size;
-} rbmeta_t;
+  if (RB_STORAGE_MIRRORED == meta->storage)
+  {
+    first->count += second->count;
+    second->count = 0;
+  }
+}
 
-//_____ M A C R O S ___________________________________________________________
-//_____ V A R I A B L E S _____________________________________________________
-//_____ P R I V A T E  F U N C T I O N S_______________________________________
-//_____ P U B L I C  F U N C T I O N S_________________________________________
 /**
- * \brief Initializes and returns a new ring buffer.
+ * \brief Fills up to two spans which cover the elements from the tail to the head.
  *
- * Detailed description see in stack.h
+ * \return Total number of elements in the spans.
  */
-ring_buffer_t *rb_create(size_t size, size_t esize)
+static size_t used_spans(const rbmeta_t *meta, ds_span_t *first, ds_span_t *second)
 {
-  UC_ASSERT(0 != esize);
-  UC_ASSERT(0 != size);
+  size_t tail = atomic_load_explicit(&meta->index->tail, memory_order_acquire);
+  size_t head = atomic_load_explicit(&meta->index->head, memory_order_acquire);
 
-  if (!is_allocator_valid())
+  first->data = meta->data + tail * meta->esize;
+  first->count = (head >= tail) ? head - tail : meta->max_size - tail;
+  second->data = meta->data;
+  second->count = (head >= tail) ? 0 : head;
+
+  merge_mirrored(meta, first, second);
+
+  return first->count + second->count;
+}
+
+/**
+ * \brief Fills up to two spans which cover the free slots from the head to the tail.
+ *
+ * One slot before the tail always stays free to distinguish the full ring buffer from the empty one.
+ *
+ * \return Total number of free slots in the spans.
+ */
+static size_t free_spans(const rbmeta_t *meta, ds_span_t *first, ds_span_t *second)
+{
+  size_t head = atomic_load_explicit(&meta->index->head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&meta->index->tail, memory_order_acquire);
+
+  first->data = meta->data + head * meta->esize;
+  second->data = meta->data;
+
+  if (head >= tail)
   {
-    return NULL;
+    first->count = meta->max_size - head - ((0 == tail) ? 1 : 0);
+    second->count = (0 != tail) ? tail - 1 : 0;
+  }
+  else
+  {
+    first->count = tail - head - 1;
+    second->count = 0;
   }
 
-  allocate_fn_t mem_allocate = get_allocator();
-  free_fn_t mem_free = get_free();
+  merge_mirrored(meta, first, second);
 
-  ring_buffer_t *rb = (ring_buffer_t *)mem_allocate(sizeof(ring_buffer_t));
-  if (NULL == rb)
+  return first->count + second->count;
+}
+
+/**
+ * \brief Flushes the written slots of the file backed storage before the head index is advanced.
+ */
+static inline void sync_slots(const rbmeta_t *meta, const void *addr, size_t count)
+{
+  if (RB_SYNC_MANUAL != meta->sync)
   {
-    return NULL;
+    rb_mapped_sync(meta, addr, count * meta->esize);
   }
+}
 
-  void *data = (void *)mem_allocate(esize);
-  if (NULL == data)
+/**
+ * \brief Flushes the indexes of the file backed storage after they were changed.
+ */
+static inline void sync_indexes(const rbmeta_t *meta)
+{
+  if (RB_SYNC_MANUAL != meta->sync)
   {
-    return NULL;
+    rb_mapped_sync(meta, meta->index, sizeof(rbindex_t));
   }
+}
 
-  memset(data, 0, esize);
+/**
+ * \brief Returns the index which follows `i`.
+ */
+static inline size_t next_index(const rbmeta_t *meta, size_t i)
+{
+  return (i + 1 < meta->max_size) ? i + 1 : 0;
+}
 
-  rb->container = container_create(esize, CONTAINER_VECTOR_BASED);
-  if (NULL == rb->container)
+/**
+ * \brief Adds the element when several producers add elements concurrently.
+ *
+ * The producer reserves the slot, writes the element and then waits until all producers which reserved
+ * the previous slots publish their elements, so the head index never passes an unwritten slot. Slots are
+ * reserved by the counter which doesn't wrap, so the stale producer can't win the exchange after the
+ * counter made the full circle and returned to the same slot.
+ */
+static bool add_multi(rbmeta_t *meta, const void *data)
+{
+  rbindex_t *index = meta->index;
+  // Acquire pairs with the exchange of other producers, so the tail loaded below isn't older than the tail
+  // which they checked before reserving the slots
+  size_t ticket = atomic_load_explicit(&index->reserve, memory_order_acquire);
+  size_t slot;
+  size_t next;
+
+  do
   {
-    return NULL;
-  }
+    slot = ticket % meta->max_size;
+    next = next_index(meta, slot);
+    if (next == atomic_load_explicit(&index->tail, memory_order_acquire))
+    {
+      return false;
+    }
+  } while (!atomic_compare_exchange_weak_explicit(&index->reserve, &ticket, ticket + 1, memory_order_acq_rel,
+                                                  memory_order_acquire));
+
+  meta->copy(meta->data + slot * meta->esize, data, meta->esize);
 
-  for (size_t i = 0; i < size; i++)
+  // The producer which reserved the previous slot may still be writing its element. If it has crashed, the wait
+  // never ends: the ring buffer has to be created again (see rb_create_shared)
+  for (unsigned spins = 0; atomic_load_explicit(&index->head, memory_order_acquire) != slot; spins++)
   {
-    if (!container_push_back(rb->container, data))
+#if RB_USE_MMAP
+    if (spins >= RB_SPIN_LIMIT)
     {
-      return NULL;
+      sched_yield();
     }
+#endif
   }
 
-  rb->meta = (void *)mem_allocate(sizeof(rbmeta_t));
-  if (NULL == rb->meta)
+  atomic_store_explicit(&index->head, next, memory_order_release);
+
+  return true;
+}
+
+/**
+ * \brief Returns size of the single element of the ring buffer for `ds_t` interface.
+ */
+static size_t ds_esize(const ds_t *ds)
+{
+  return ((const rbmeta_t *)ds->meta)->esize;
+}
+
+/**
+ * \brief Returns elements of the ring buffer from the tail to the head for `ds_t` interface.
+ *
+ * The elements are returned as one span or as two spans if they wrap around the end of the storage.
+ */
+static bool ds_next_span(const ds_t *ds, void **pos, ds_span_t *span)
+{
+  const rbmeta_t *meta = (const rbmeta_t *)ds->meta;
+
+  uint8_t *end = meta->data + meta->max_size * meta->esize;
+  ds_span_t other;
+
+  if (NULL == *pos)
+  {
+    used_spans(meta, span, &other);
+    *pos = (0 != other.count) ? meta->data : end;
+
+    return (0 != span->count);
+  }
+
+  if (*pos == meta->data)
+  {
+    used_spans(meta, &other, span);
+    *pos = end;
+
+    return (0 != span->count);
+  }
+
+  return false;
+}
+
+/**
+ * \brief Returns max number of elements of the ring buffer for `ds_t` interface.
+ */
+static size_t ds_capacity(const ds_t *ds)
+{
+  return ((const rbmeta_t *)ds->meta)->max_size;
+}
+
+const ds_iface_t rb_iface = {
+  .esize = ds_esize,
+  .next_span = ds_next_span,
+  .capacity = ds_capacity,
+  .kind = DS_KIND_RING_BUFFER,
+};
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Initializes the meta of the ring buffer.
+ *
+ * Detailed description see in rb_private.h
+ */
+void rb_init_meta(rbmeta_t *meta, rbindex_t *index, size_t size, size_t esize, uint8_t *data)
+{
+  meta->index = index;
+  meta->max_size = size;
+  meta->esize = esize;
+  meta->storage = RB_STORAGE_HEAP;
+  meta->sync = RB_SYNC_MANUAL;
+  meta->multi_producer = false;
+  meta->copy = ds_copy_select(esize);
+  meta->data = data;
+  meta->mapping = NULL;
+  meta->mapped_size = 0;
+  meta->io_head = 0;
+  meta->io_tail = 0;
+}
+
+/**
+ * \brief Initializes the indexes of the empty ring buffer.
+ *
+ * Detailed description see in rb_private.h
+ */
+void rb_init_index(rbindex_t *index)
+{
+  memset(index, 0, sizeof(rbindex_t));
+  atomic_init(&index->head, 0);
+  atomic_init(&index->reserve, 0);
+  atomic_init(&index->tail, 0);
+}
+
+/**
+ * \brief Initializes and returns a new ring buffer.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ring_buffer_t *rb_create(size_t size, size_t esize)
+{
+  UC_ASSERT(0 != esize);
+  UC_ASSERT(0 != size);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  if (size > (SIZE_MAX - sizeof(ring_buffer_t) - sizeof(rbmeta_t) - sizeof(rbindex_t)) / esize)
   {
-    container_delete(&rb->container);
-    mem_free(data);
-    mem_free(rb);
     return NULL;
   }
 
+  allocate_fn_t mem_allocate = get_allocator();
+
+  ring_buffer_t *rb =
+    (ring_buffer_t *)mem_allocate(sizeof(ring_buffer_t) + sizeof(rbmeta_t) + sizeof(rbindex_t) + size * esize);
+  if (NULL == rb)
+  {
+    return NULL;
+  }
+
+  rb->meta = (void *)((uint8_t *)rb + sizeof(ring_buffer_t));
+  rb->iface = &rb_iface;
+
   rbmeta_t *meta = (rbmeta_t *)rb->meta;
-  meta->head = 0;
-  meta->tail = 0;
-  meta->max_size = size;
+  rbindex_t *index = (rbindex_t *)((uint8_t *)meta + sizeof(rbmeta_t));
+  rb_init_index(index);
+  rb_init_meta(meta, index, size, esize, (uint8_t *)index + sizeof(rbindex_t));
 
   return rb;
 }
@@ -100,47 +305,63 @@ ring_buffer_t *rb_create(size_t size, size_t esize)
 /**
  * \brief Frees up the memory associated with the ring buffer.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 void rb_delete(ring_buffer_t **rb)
 {
   UC_ASSERT(rb);
   UC_ASSERT(*rb);
-  UC_ASSERT((*rb)->container);
   UC_ASSERT((*rb)->meta);
 
-  free_fn_t mem_free = get_free();
+  switch (((rbmeta_t *)(*rb)->meta)->storage)
+  {
+    case RB_STORAGE_FILE: rb_mapped_release(*rb); break;
+    case RB_STORAGE_SHARED: rb_shared_release(*rb); break;
+    case RB_STORAGE_MIRRORED: rb_mirrored_release(*rb); break;
+    case RB_STORAGE_PAGES: rb_pages_release(*rb); break;
+    default:
+    {
+      free_fn_t mem_free = get_free();
+      mem_free(*rb);
+      break;
+    }
+  }
 
-  container_delete((container_t **)(*rb)->container);
-  mem_free(((*rb)->meta));
-  mem_free(*rb);
   *rb = NULL;
 }
 
 /**
  * \brief Adds an element to the ring buffer.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 bool rb_add(ring_buffer_t *rb, const void *data)
 {
-  UC_ASSERT(rb);
-  UC_ASSERT(rb->container);
-  UC_ASSERT(data);
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(data);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
 
-  if (rb_is_full(rb))
+  if (meta->multi_producer)
   {
-    return false;
+    return add_multi(meta, data);
   }
 
-  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  size_t head = atomic_load_explicit(&meta->index->head, memory_order_relaxed);
+  size_t next = next_index(meta, head);
 
-  if (!container_replace(rb->container, data, meta->head))
+  if (next == atomic_load_explicit(&meta->index->tail, memory_order_acquire))
   {
     return false;
   }
 
-  meta->head = (meta->head + 1) % meta->max_size;
+  uint8_t *slot = meta->data + head * meta->esize;
+  meta->copy(slot, data, meta->esize);
+  sync_slots(meta, slot, 1);
+
+  atomic_store_explicit(&meta->index->head, next, memory_order_release);
+  sync_indexes(meta);
 
   return true;
 }
@@ -148,102 +369,291 @@ bool rb_add(ring_buffer_t *rb, const void *data)
 /**
  * \brief Removes an element from the ring buffer and returns it.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 bool rb_get(ring_buffer_t *rb, void *data)
 {
-  UC_ASSERT(rb);
-  UC_ASSERT(rb->container);
-  UC_ASSERT(data);
-
-  if (rb_is_empty(rb))
-  {
-    return false;
-  }
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(data);
 
   rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  size_t tail = atomic_load_explicit(&meta->index->tail, memory_order_relaxed);
 
-  if (!container_at((container_t *)rb->container, data, meta->tail))
+  if (tail == atomic_load_explicit(&meta->index->head, memory_order_acquire))
   {
     return false;
   }
 
-  meta->tail = (meta->tail + 1) % meta->max_size;
+  meta->copy(data, meta->data + tail * meta->esize, meta->esize);
+
+  atomic_store_explicit(&meta->index->tail, next_index(meta, tail), memory_order_release);
+  sync_indexes(meta);
+
+  return true;
 }
 
 /**
  * \brief Retrieves an element from the ring buffer without removing it.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 bool rb_peek(const ring_buffer_t *rb, void *data)
 {
-  UC_ASSERT(rb);
-  UC_ASSERT(rb->container);
-  UC_ASSERT(data);
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(data);
 
-  if (rb_is_empty(rb))
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  size_t tail = atomic_load_explicit(&meta->index->tail, memory_order_relaxed);
+
+  if (tail == atomic_load_explicit(&meta->index->head, memory_order_acquire))
   {
     return false;
   }
 
-  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  meta->copy(data, meta->data + tail * meta->esize, meta->esize);
 
-  return container_at((container_t *)rb->container, data, meta->tail);
+  return true;
 }
 
 /**
  * \brief Returns the number of elements in the ring buffer.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 size_t rb_size(const ring_buffer_t *rb)
 {
-  UC_ASSERT(rb);
+  DS_ASSERT_CHEAP(rb);
 
   rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  size_t tail = atomic_load_explicit(&meta->index->tail, memory_order_acquire);
+  size_t head = atomic_load_explicit(&meta->index->head, memory_order_acquire);
 
-  return abs((int)(meta->tail - meta->head));
+  return (head + meta->max_size - tail) % meta->max_size;
 }
 
 /**
  * \brief Checks if the ring buffer is empty.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 bool rb_is_empty(const ring_buffer_t *rb)
 {
-  UC_ASSERT(rb);
+  DS_ASSERT_CHEAP(rb);
 
   rbmeta_t *meta = (rbmeta_t *)rb->meta;
-  return (abs((int)(meta->tail - meta->head)) == 0);
+  return atomic_load_explicit(&meta->index->tail, memory_order_acquire) ==
+         atomic_load_explicit(&meta->index->head, memory_order_acquire);
 }
 
 /**
  * \brief Checks if the ring buffer is full.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 bool rb_is_full(const ring_buffer_t *rb)
 {
-  UC_ASSERT(rb);
+  DS_ASSERT_CHEAP(rb);
 
   rbmeta_t *meta = (rbmeta_t *)rb->meta;
-  return (abs((int)(meta->tail - meta->head)) >= meta->max_size - 1);
+  return (rb_size(rb) >= meta->max_size - 1);
+}
+
+/**
+ * \brief Checks if the elements may be added by several producers.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_is_multi_producer(const ring_buffer_t *rb)
+{
+  DS_ASSERT_CHEAP(rb);
+
+  return ((const rbmeta_t *)rb->meta)->multi_producer;
 }
 
 /**
  * \brief Clears all the elements from the ring buffer.
  *
- * Detailed description see in stack.h
+ * Detailed description see in ring_buffer.h
  */
 bool rb_clear(ring_buffer_t *rb)
 {
-  UC_ASSERT(rb);
+  DS_ASSERT_CHEAP(rb);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  atomic_store_explicit(&meta->index->tail, 0, memory_order_relaxed);
+  atomic_store_explicit(&meta->index->reserve, 0, memory_order_relaxed);
+  atomic_store_explicit(&meta->index->head, 0, memory_order_release);
+  sync_indexes(meta);
+  meta->io_head = 0;
+  meta->io_tail = 0;
+
+  return true;
+}
+
+/**
+ * \brief Returns the elements of the ring buffer as contiguous spans of its storage.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+size_t rb_get_spans(const ring_buffer_t *rb, ds_span_t *first, ds_span_t *second)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_CHEAP(first);
+  DS_ASSERT_CHEAP(second);
+  DS_ASSERT_PARANOID(rb->meta);
+
+  return used_spans((const rbmeta_t *)rb->meta, first, second);
+}
+
+/**
+ * \brief Returns the free slots of the ring buffer as contiguous spans of its storage.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+size_t rb_get_free_spans(const ring_buffer_t *rb, ds_span_t *first, ds_span_t *second)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_CHEAP(first);
+  DS_ASSERT_CHEAP(second);
+  DS_ASSERT_PARANOID(rb->meta);
+
+  return free_spans((const rbmeta_t *)rb->meta, first, second);
+}
+
+/**
+ * \brief Marks the elements written directly into the free spans as added.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_advance_head(ring_buffer_t *rb, size_t count)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  DS_ASSERT_CHEAP(!meta->multi_producer);
+
+  ds_span_t first;
+  ds_span_t second;
+  if (count > free_spans(meta, &first, &second))
+  {
+    return false;
+  }
+
+  if (RB_SYNC_MANUAL != meta->sync)
+  {
+    size_t n = (count < first.count) ? count : first.count;
+    sync_slots(meta, first.data, n);
+    sync_slots(meta, second.data, count - n);
+  }
+
+  size_t head = atomic_load_explicit(&meta->index->head, memory_order_relaxed);
+  atomic_store_explicit(&meta->index->head, (head + count) % meta->max_size, memory_order_release);
+  sync_indexes(meta);
+
+  return true;
+}
+
+/**
+ * \brief Removes the elements which were processed directly in the spans.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_advance_tail(ring_buffer_t *rb, size_t count)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
 
   rbmeta_t *meta = (rbmeta_t *)rb->meta;
 
-  meta->tail = meta->head = 0;
+  if (count > rb_size(rb))
+  {
+    return false;
+  }
+
+  size_t tail = atomic_load_explicit(&meta->index->tail, memory_order_relaxed);
+  atomic_store_explicit(&meta->index->tail, (tail + count) % meta->max_size, memory_order_release);
+  sync_indexes(meta);
+
+  return true;
+}
+
+/**
+ * \brief Adds several elements to the ring buffer.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_add_batch(ring_buffer_t *rb, const void *data, size_t count)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(data || 0 == count);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  DS_ASSERT_CHEAP(!meta->multi_producer);
+
+  ds_span_t first;
+  ds_span_t second;
+  if (count > free_spans(meta, &first, &second))
+  {
+    return false;
+  }
+
+  size_t n = (count < first.count) ? count : first.count;
+  if (0 != n)
+  {
+    memcpy(first.data, data, n * meta->esize);
+    sync_slots(meta, first.data, n);
+  }
+  if (count != n)
+  {
+    memcpy(second.data, (const uint8_t *)data + n * meta->esize, (count - n) * meta->esize);
+    sync_slots(meta, second.data, count - n);
+  }
+
+  size_t head = atomic_load_explicit(&meta->index->head, memory_order_relaxed);
+  atomic_store_explicit(&meta->index->head, (head + count) % meta->max_size, memory_order_release);
+  sync_indexes(meta);
+
+  return true;
+}
+
+/**
+ * \brief Removes several elements from the ring buffer and returns them.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_get_batch(ring_buffer_t *rb, void *data, size_t count)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(data || 0 == count);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  ds_span_t first;
+  ds_span_t second;
+  if (count > used_spans(meta, &first, &second))
+  {
+    return false;
+  }
+
+  size_t n = (count < first.count) ? count : first.count;
+  if (0 != n)
+  {
+    memcpy(data, first.data, n * meta->esize);
+  }
+  if (count != n)
+  {
+    memcpy((uint8_t *)data + n * meta->esize, second.data, (count - n) * meta->esize);
+  }
+
+  size_t tail = atomic_load_explicit(&meta->index->tail, memory_order_relaxed);
+  atomic_store_explicit(&meta->index->tail, (tail + count) % meta->max_size, memory_order_release);
+  sync_indexes(meta);
 
   return true;
 }
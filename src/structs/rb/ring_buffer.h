@@ -12,10 +12,42 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "platform/mem_pages.h"
 #include "structs/ds.h"
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
 typedef ds_t ring_buffer_t;
+
+/**
+ * \brief Policy of flushing the changes of the ring buffer placed in the memory mapped file.
+ */
+typedef enum
+{
+  RB_SYNC_MANUAL = 0, /**< Changes are flushed by `rb_flush`, `rb_delete` or by the OS at any time */
+  RB_SYNC_ASYNC,      /**< Every change is scheduled for writing to the disk without waiting */
+  RB_SYNC_FULL,       /**< Every change is written to the disk before the function returns */
+} rb_sync_t;
+
+/**
+ * \brief Mode of access to the ring buffer placed in the shared memory.
+ */
+typedef enum
+{
+  RB_SHARED_SPSC = 0, /**< Single producer and single consumer */
+  RB_SHARED_MPSC,     /**< Multiple producers and single consumer, a crashed producer may wedge the others */
+} rb_shared_mode_t;
+
+/** Alignment of the headers and the payload of the records written by `rb_write_record` */
+#define RB_RECORD_ALIGN 8U
+
+/**
+ * \brief View of the record placed in the storage of the ring buffer.
+ */
+typedef struct
+{
+  const void *data; /**< Payload of the record */
+  size_t length;    /**< Length in bytes of the payload */
+} rb_record_t;
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P U B L I C  F U N C T I O N S_________________________________________
@@ -29,6 +61,104 @@ typedef ds_t ring_buffer_t;
  */
 ring_buffer_t *rb_create(size_t size, size_t esize);
 
+/**
+ * \brief Creates the ring buffer whose storage is mapped with the selected page size and NUMA node.
+ *
+ * The storage of multi-gigabyte ring buffers is better backed by huge pages, which reduce TLB misses, and
+ * placed on the NUMA node of the consumer. If `opts->populate` is false the pages are placed on the first
+ * touch, which can be done by `rb_prefault` from the consumer thread.
+ *
+ * \param[in] size The size in elements of this ring buffer.
+ * \param[in] esize The size in bytes of the single element that this ring buffer will store.
+ * \param[in] opts Options of the allocation, see mem_pages.h.
+ *
+ * \return Pointer to the ring buffer or NULL if the storage can't be mapped or bound to the node.
+ */
+ring_buffer_t *rb_create_pages(size_t size, size_t esize, const mem_pages_opts_t *opts);
+
+/**
+ * \brief Touches every page of the storage from the calling thread without changing the elements.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \warning The ring buffer must not be modified concurrently.
+ */
+void rb_prefault(ring_buffer_t *rb);
+
+/**
+ * \brief Opens or creates the ring buffer placed in the memory mapped file.
+ *
+ * The file keeps the header (format version, `size`, `esize`), the indexes of the head and the tail and
+ * the storage, so the elements survive the restart of the process and are accessed without copying into
+ * the heap. If the file exists it is validated and the ring buffer is recovered from it. The new file is
+ * initialized so that the crash during creation leaves it either empty or detected as not initialized.
+ *
+ * The element is written into the storage before the head index is advanced, so with `RB_SYNC_FULL`
+ * policy the file always contains complete elements after the crash.
+ *
+ * \param[in] path Path to the file.
+ * \param[in] size The size in elements of this ring buffer.
+ * \param[in] esize The size in bytes of the single element that this ring buffer will store.
+ *
+ * \note The file is not portable between the platforms with different size of `size_t`.
+ * \return Pointer to the ring buffer or NULL if the file can't be mapped, is corrupted or was created with
+ *         other `size` or `esize`.
+ */
+ring_buffer_t *rb_create_mapped(const char *path, size_t size, size_t esize);
+
+/**
+ * \brief Creates the ring buffer placed in the new POSIX shared memory object.
+ *
+ * The shared memory keeps the header, the atomic indexes of the head and the tail and the storage but no
+ * pointers, so other processes can map it at any address by `rb_attach_shared`. The producer and the consumer
+ * exchange elements without system calls. `rb_delete` detaches the ring buffer from the shared memory of the
+ * current process, the object itself exists until `rb_unlink_shared` is called.
+ *
+ * \param[in] name Name of the shared memory object, e.g. "/capture".
+ * \param[in] size The size in elements of this ring buffer.
+ * \param[in] esize The size in bytes of the single element that this ring buffer will store.
+ * \param[in] mode Mode of access which is used by all processes.
+ *
+ * \warning In `RB_SHARED_SPSC` mode only one thread in all processes may add elements. In both modes only
+ *          one thread in all processes may retrieve elements. `rb_clear` must not be called concurrently.
+ * \warning In `RB_SHARED_MPSC` mode the producers publish their slots in the order of reservation, so the
+ *          producer which dies between the reservation of the slot and its publication blocks all producers
+ *          which reserved slots after it forever. There is no recovery: the ring buffer has to be unlinked and
+ *          created again after all processes detach from it.
+ * \return Pointer to the ring buffer or NULL if the object already exists or can't be created.
+ */
+ring_buffer_t *rb_create_shared(const char *name, size_t size, size_t esize, rb_shared_mode_t mode);
+
+/**
+ * \brief Attaches to the ring buffer placed in the shared memory object created by `rb_create_shared`.
+ *
+ * \param[in] name Name of the shared memory object.
+ * \return Pointer to the ring buffer or NULL if the object doesn't exist or isn't the ring buffer.
+ */
+ring_buffer_t *rb_attach_shared(const char *name);
+
+/**
+ * \brief Removes the name of the shared memory object. The memory is freed when all processes detach.
+ *
+ * \param[in] name Name of the shared memory object.
+ * \return true if the operation was successful, false otherwise.
+ */
+bool rb_unlink_shared(const char *name);
+
+/**
+ * \brief Creates the ring buffer whose storage is mapped twice back to back in the virtual memory.
+ *
+ * The slot which follows the last slot of the storage is the first slot again, so the elements and the free
+ * slots are always returned as one contiguous span by `rb_get_spans` and `rb_get_free_spans` and
+ * `rb_add_batch`/`rb_get_batch` copy them by the single `memcpy`.
+ *
+ * \param[in] size The size in elements of this ring buffer. It is rounded up so that the storage occupies
+ *                 whole pages.
+ * \param[in] esize The size in bytes of the single element that this ring buffer will store.
+ *
+ * \return Pointer to the ring buffer or NULL if the platform doesn't support the mapping.
+ */
+ring_buffer_t *rb_create_mirrored(size_t size, size_t esize);
+
 /**
  * \brief Frees up the memory associated with the ring buffer.
  *
@@ -52,6 +182,17 @@ bool rb_is_empty(const ring_buffer_t *rb);
  */
 bool rb_is_full(const ring_buffer_t *rb);
 
+/**
+ * \brief Checks if the elements may be added to the ring buffer by several producers.
+ *
+ * Such ring buffer supports only `rb_add` for adding: the spans, the batches and the descriptor transfers
+ * work with the head owned by the single producer.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \return true if the ring buffer is created or attached in `RB_SHARED_MPSC` mode, false otherwise.
+ */
+bool rb_is_multi_producer(const ring_buffer_t *rb);
+
 /**
  * \brief Adds an element to the ring buffer.
  *
@@ -94,3 +235,164 @@ size_t rb_size(const ring_buffer_t *rb);
  * \return true if the operation was successful, false otherwise.
  */
 bool rb_clear(ring_buffer_t *rb);
+
+/**
+ * \brief Returns the elements of the ring buffer as contiguous spans of its storage without copying them.
+ *
+ * The elements are placed in `first` span and, if they wrap around the end of the storage, in `second` span.
+ * The unused span has zero `count`. The elements can be processed directly in the storage and then removed
+ * by `rb_advance_tail`.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[out] first Span with the oldest elements.
+ * \param[out] second Span with the rest of the elements.
+ * \warning The spans are valid only until the next call of the function which changes the ring buffer.
+ * \return Number of elements in both spans.
+ */
+size_t rb_get_spans(const ring_buffer_t *rb, ds_span_t *first, ds_span_t *second);
+
+/**
+ * \brief Returns the free slots of the ring buffer as contiguous spans of its storage.
+ *
+ * The new elements can be written directly into the slots and then added by `rb_advance_head`. The `first`
+ * span has to be filled before the `second` one.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[out] first Span with the slots which follow the newest element.
+ * \param[out] second Span with the rest of the slots.
+ * \warning The spans are valid only until the next call of the function which changes the ring buffer.
+ * \return Number of slots in both spans.
+ */
+size_t rb_get_free_spans(const ring_buffer_t *rb, ds_span_t *first, ds_span_t *second);
+
+/**
+ * \brief Adds the elements which were written directly into the free spans.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[in] count Number of the written elements.
+ * \return true if the operation was successful, false if there are less than `count` free slots.
+ */
+bool rb_advance_head(ring_buffer_t *rb, size_t count);
+
+/**
+ * \brief Removes the oldest elements without copying them.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[in] count Number of the elements to remove.
+ * \return true if the operation was successful, false if there are less than `count` elements.
+ */
+bool rb_advance_tail(ring_buffer_t *rb, size_t count);
+
+/**
+ * \brief Adds several elements to the ring buffer.
+ *
+ * Either all `count` elements are added or none of them.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[in] data Pointer to the array of `count` elements.
+ * \param[in] count Number of the elements.
+ * \return true if the operation was successful, false if there are less than `count` free slots.
+ */
+bool rb_add_batch(ring_buffer_t *rb, const void *data, size_t count);
+
+/**
+ * \brief Removes several oldest elements from the ring buffer and returns them.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[out] data Pointer to the array for `count` elements.
+ * \param[in] count Number of the elements.
+ * \return true if the operation was successful, false if there are less than `count` elements.
+ */
+bool rb_get_batch(ring_buffer_t *rb, void *data, size_t count);
+
+/**
+ * \brief Reads the data from the descriptor directly into the free slots of the ring buffer.
+ *
+ * The free spans are passed to the single `readv` and the head is advanced by the number of whole elements
+ * read. The bytes of the incomplete element are kept in its slot and the element is added when the rest of it
+ * is read by the next call, so the ring buffer must not be mixed with `rb_add` while the element is incomplete.
+ * The call interrupted by the signal is restarted.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[in] fd Descriptor of the file, the pipe or the socket.
+ * \param[in] max Max number of bytes to read.
+ * \return Number of read bytes, 0 at the end of file or if `max` is 0, -1 on error with `errno` set: ENOBUFS
+ *         if there are no free slots, EAGAIN for the non-blocking descriptor without data etc.
+ */
+ptrdiff_t rb_read_from_fd(ring_buffer_t *rb, int fd, size_t max);
+
+/**
+ * \brief Writes the elements of the ring buffer to the descriptor directly from the storage.
+ *
+ * The spans of the elements are passed to the single `writev` and the tail is advanced by the number of whole
+ * elements written. The element written partially stays in the ring buffer until the rest of it is written by
+ * the next call, so the ring buffer must not be mixed with `rb_get` while the element is incomplete.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[in] fd Descriptor of the file, the pipe or the socket.
+ * \param[in] max Max number of bytes to write.
+ * \return Number of written bytes, 0 if `max` is 0 or the descriptor took no bytes, -1 on error with `errno` set:
+ *         ENODATA if the ring buffer is empty, EAGAIN for the non-blocking descriptor which is full etc.
+ */
+ptrdiff_t rb_write_to_fd(ring_buffer_t *rb, int fd, size_t max);
+
+/**
+ * \brief Writes the record of variable length to the ring buffer.
+ *
+ * The records are stored in the ring buffer of bytes (`esize` is 1) whose size is a multiple of
+ * `RB_RECORD_ALIGN`, e.g. created by `rb_create(size, 1)` or `rb_create_mirrored(size, 1)`. Every record
+ * occupies its length rounded up to `RB_RECORD_ALIGN` plus the header of `RB_RECORD_ALIGN` bytes instead of
+ * the slot of the maximal size. The ring buffer must not be mixed with `rb_add`/`rb_get`.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[in] data Pointer to the payload.
+ * \param[in] length Length in bytes of the payload, may be zero.
+ * \return true if the operation was successful, false if there is not enough contiguous free space.
+ */
+bool rb_write_record(ring_buffer_t *rb, const void *data, size_t length);
+
+/**
+ * \brief Copies the oldest record and removes it.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[out] data Pointer to the buffer for the payload.
+ * \param[in] size Size in bytes of the buffer.
+ * \param[out] length Length of the record. If it exceeds `size` the record is neither copied nor removed.
+ * \return true if the operation was successful, false if there are no records or the buffer is too small.
+ */
+bool rb_read_record(ring_buffer_t *rb, void *data, size_t size, size_t *length);
+
+/**
+ * \brief Returns the view of the oldest record placed in the storage without copying and removing it.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[out] record View of the record. The payload is contiguous and aligned to `RB_RECORD_ALIGN`.
+ * \warning The view is valid until the record is removed by `rb_release_record`.
+ * \return true if the operation was successful, false if there are no records.
+ */
+bool rb_peek_record(const ring_buffer_t *rb, rb_record_t *record);
+
+/**
+ * \brief Removes the oldest record, e.g. after its view was processed.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \return true if the operation was successful, false if there are no records.
+ */
+bool rb_release_record(ring_buffer_t *rb);
+
+/**
+ * \brief Sets the policy of flushing the changes of the ring buffer placed in the memory mapped file.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \param[in] sync The policy.
+ * \return true if the operation was successful, false if the ring buffer is not placed in the file.
+ */
+bool rb_set_sync(ring_buffer_t *rb, rb_sync_t sync);
+
+/**
+ * \brief Writes all changes of the ring buffer placed in the memory mapped file to the disk.
+ *
+ * \param[in] rb Pointer to the ring buffer.
+ * \return true if the operation was successful or the ring buffer is not placed in the file, false otherwise.
+ */
+bool rb_flush(ring_buffer_t *rb);
@@ -0,0 +1,194 @@
+/**
+ * @file ring_buffer_io.c
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Transfer of the elements of the ring buffer from and to the file descriptors.
+ * @date 2026-10-18
+ *
+ * The free slots and the elements are passed to `readv`/`writev` directly as the spans of the storage, so the
+ * data is copied only once by the kernel. The descriptor may return the part of the element, such bytes are
+ * kept in the slot and counted in the meta until the rest of the element is transferred by the next call.
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ring_buffer.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "structs/ds_assert.h"
+#include "rb_private.h"
+
+#if RB_USE_MMAP
+  #include <limits.h>
+  #include <sys/uio.h>
+  #include <unistd.h>
+#endif
+//_____ C O N F I G S  ________________________________________________________
+/** Error of `rb_write_to_fd` for the empty ring buffer on the platforms which don't define ENODATA */
+#ifndef ENODATA
+  #define ENODATA ENOBUFS
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Fills the vector with the spans skipping `offset` bytes and limiting the total size by `max` bytes.
+ *
+ * \return Number of filled entries of the vector.
+ */
+static int fill_iov(struct iovec iov[2], const ds_span_t spans[2], size_t esize, size_t offset, size_t max)
+{
+  int cnt = 0;
+
+  for (size_t i = 0; i < 2 && max > 0; i++)
+  {
+    size_t len = spans[i].count * esize - offset;
+    if (0 == len)
+    {
+      continue;
+    }
+
+    if (len > max)
+    {
+      len = max;
+    }
+
+    iov[cnt].iov_base = (uint8_t *)spans[i].data + offset;
+    iov[cnt].iov_len = len;
+    cnt++;
+
+    max -= len;
+    offset = 0;
+  }
+
+  return cnt;
+}
+
+/**
+ * \brief Returns the max number of bytes for the single call of `readv`/`writev`.
+ */
+static size_t limit_max(size_t max)
+{
+  return (max > (size_t)SSIZE_MAX) ? (size_t)SSIZE_MAX : max;
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Reads the data from the descriptor directly into the free slots of the ring buffer.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ptrdiff_t rb_read_from_fd(ring_buffer_t *rb, int fd, size_t max)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  ds_span_t spans[2];
+  struct iovec iov[2];
+
+  if (0 == rb_get_free_spans(rb, &spans[0], &spans[1]))
+  {
+    errno = ENOBUFS;
+    return -1;
+  }
+
+  int cnt = fill_iov(iov, spans, meta->esize, meta->io_head, limit_max(max));
+  if (0 == cnt)
+  {
+    return 0;
+  }
+
+  ssize_t n;
+  do
+  {
+    n = readv(fd, iov, cnt);
+  } while (n < 0 && EINTR == errno);
+
+  if (n <= 0)
+  {
+    return (ptrdiff_t)n;
+  }
+
+  size_t total = meta->io_head + (size_t)n;
+  meta->io_head = total % meta->esize;
+  if (total >= meta->esize)
+  {
+    rb_advance_head(rb, total / meta->esize);
+  }
+
+  return (ptrdiff_t)n;
+}
+
+/**
+ * \brief Writes the elements of the ring buffer to the descriptor directly from the storage.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ptrdiff_t rb_write_to_fd(ring_buffer_t *rb, int fd, size_t max)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  ds_span_t spans[2];
+  struct iovec iov[2];
+
+  if (0 == rb_get_spans(rb, &spans[0], &spans[1]))
+  {
+    errno = ENODATA;
+    return -1;
+  }
+
+  int cnt = fill_iov(iov, spans, meta->esize, meta->io_tail, limit_max(max));
+  if (0 == cnt)
+  {
+    return 0;
+  }
+
+  ssize_t n;
+  do
+  {
+    n = writev(fd, iov, cnt);
+  } while (n < 0 && EINTR == errno);
+
+  if (n <= 0)
+  {
+    return (ptrdiff_t)n;
+  }
+
+  size_t total = meta->io_tail + (size_t)n;
+  meta->io_tail = total % meta->esize;
+  if (total >= meta->esize)
+  {
+    rb_advance_tail(rb, total / meta->esize);
+  }
+
+  return (ptrdiff_t)n;
+}
+#else
+ptrdiff_t rb_read_from_fd(ring_buffer_t *rb, int fd, size_t max)
+{
+  (void)rb;
+  (void)fd;
+  (void)max;
+  errno = ENOSYS;
+  return -1;
+}
+
+ptrdiff_t rb_write_to_fd(ring_buffer_t *rb, int fd, size_t max)
+{
+  (void)rb;
+  (void)fd;
+  (void)max;
+  errno = ENOSYS;
+  return -1;
+}
+#endif
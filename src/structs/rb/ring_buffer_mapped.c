@@ -0,0 +1,326 @@
+/**
+ * @file ring_buffer_mapped.c
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Ring buffer placed in the memory mapped file.
+ * @date 2026-10-18
+ *
+ * Layout of the file: header, indexes of the ring buffer (`rbindex_t`) and the storage. Both the indexes and the
+ * storage start at the offsets aligned to the cache line. The file doesn't contain any pointers, so it can be
+ * mapped at any address.
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ring_buffer.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "rb_private.h"
+
+#if RB_USE_MMAP
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/** Magic number of the file: "UDRB" */
+#define RB_FILE_MAGIC 0x42524455U
+
+/** Version of the file layout */
+#define RB_FILE_VERSION 2U
+
+/**
+ * \brief Header of the file.
+ *
+ * The magic number is written the last one when the new file is initialized, so the file with zero magic
+ * number is the file whose initialization was interrupted.
+ */
+typedef struct
+{
+  uint32_t magic;       /**< `RB_FILE_MAGIC` */
+  uint32_t version;     /**< `RB_FILE_VERSION` */
+  uint64_t header_size; /**< Size of the header and the indexes, detects incompatible builds */
+  uint64_t max_size;    /**< Number of slots in the storage */
+  uint64_t esize;       /**< Size in bytes of the single element */
+} rbfile_header_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Returns the offset of the indexes from the beginning of the file.
+ */
+static size_t index_offset(void)
+{
+  return (sizeof(rbfile_header_t) + RB_CACHE_LINE - 1) & ~(size_t)(RB_CACHE_LINE - 1);
+}
+
+/**
+ * \brief Returns the offset of the storage from the beginning of the file.
+ */
+static size_t data_offset(void)
+{
+  return index_offset() + ((sizeof(rbindex_t) + RB_CACHE_LINE - 1) & ~(size_t)(RB_CACHE_LINE - 1));
+}
+
+/**
+ * \brief Flushes the pages which contain the range of the mapping.
+ */
+static bool sync_range(const void *addr, size_t size, int flags)
+{
+  uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+  uintptr_t begin = (uintptr_t)addr & ~(page - 1);
+  uintptr_t end = (uintptr_t)addr + size;
+
+  return 0 == msync((void *)begin, end - begin, flags);
+}
+
+/**
+ * \brief Checks that the file was created for the ring buffer with the same parameters and is consistent.
+ */
+static bool is_header_valid(const rbfile_header_t *header, rbindex_t *index, size_t size, size_t esize)
+{
+  if (RB_FILE_VERSION != header->version || sizeof(rbfile_header_t) + sizeof(rbindex_t) != header->header_size ||
+      size != header->max_size || esize != header->esize)
+  {
+    return false;
+  }
+
+  size_t head = atomic_load(&index->head);
+  size_t tail = atomic_load(&index->tail);
+
+  if (head >= size || tail >= size)
+  {
+    return false;
+  }
+
+  // The file is written by the single producer, so no slots are reserved beyond the head
+  atomic_store(&index->reserve, head);
+
+  return true;
+}
+
+/**
+ * \brief Initializes the header and the indexes of the new file.
+ */
+static bool init_file(rbfile_header_t *header, rbindex_t *index, size_t size, size_t esize)
+{
+  header->version = RB_FILE_VERSION;
+  header->header_size = sizeof(rbfile_header_t) + sizeof(rbindex_t);
+  header->max_size = size;
+  header->esize = esize;
+  rb_init_index(index);
+
+  if (!sync_range(header, index_offset() + sizeof(rbindex_t), MS_SYNC))
+  {
+    return false;
+  }
+
+  header->magic = RB_FILE_MAGIC;
+
+  return sync_range(header, sizeof(rbfile_header_t), MS_SYNC);
+}
+
+/**
+ * \brief Maps the file of `file_size` bytes, creates it if it doesn't exist.
+ *
+ * \return Pointer to the mapping or NULL.
+ */
+static void *map_file(const char *path, size_t file_size)
+{
+  int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (fd < 0)
+  {
+    return NULL;
+  }
+
+  struct stat st;
+  bool ok = (0 == fstat(fd, &st));
+
+  if (ok && 0 == st.st_size)
+  {
+    ok = (0 == ftruncate(fd, (off_t)file_size));
+  }
+  else if (ok)
+  {
+    ok = ((uint64_t)st.st_size == (uint64_t)file_size);
+  }
+
+  void *mapping = ok ? mmap(NULL, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+  // The mapping stays valid after the descriptor is closed
+  close(fd);
+
+  return (MAP_FAILED != mapping) ? mapping : NULL;
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Opens or creates the ring buffer placed in the memory mapped file.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ring_buffer_t *rb_create_mapped(const char *path, size_t size, size_t esize)
+{
+  UC_ASSERT(path);
+  UC_ASSERT(0 != esize);
+  UC_ASSERT(0 != size);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  if (size > (SIZE_MAX - data_offset()) / esize || data_offset() + size * esize > (uint64_t)INT64_MAX)
+  {
+    return NULL;
+  }
+
+  size_t file_size = data_offset() + size * esize;
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  ring_buffer_t *rb = (ring_buffer_t *)mem_allocate(sizeof(ring_buffer_t) + sizeof(rbmeta_t));
+  if (NULL == rb)
+  {
+    return NULL;
+  }
+
+  uint8_t *mapping = (uint8_t *)map_file(path, file_size);
+  if (NULL == mapping)
+  {
+    mem_free(rb);
+    return NULL;
+  }
+
+  rbfile_header_t *header = (rbfile_header_t *)mapping;
+  rbindex_t *index = (rbindex_t *)(mapping + index_offset());
+
+  bool ok = (0 == header->magic) ? init_file(header, index, size, esize)
+                                 : (RB_FILE_MAGIC == header->magic && is_header_valid(header, index, size, esize));
+  if (!ok)
+  {
+    munmap(mapping, file_size);
+    mem_free(rb);
+    return NULL;
+  }
+
+  rb->meta = (void *)((uint8_t *)rb + sizeof(ring_buffer_t));
+  rb->iface = &rb_iface;
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  rb_init_meta(meta, index, size, esize, mapping + data_offset());
+  meta->storage = RB_STORAGE_FILE;
+  meta->mapping = mapping;
+  meta->mapped_size = file_size;
+
+  return rb;
+}
+
+/**
+ * \brief Flushes the range of the mapped file according to the sync policy.
+ *
+ * Detailed description see in rb_private.h
+ */
+void rb_mapped_sync(const rbmeta_t *meta, const void *addr, size_t size)
+{
+  if (0 != size)
+  {
+    (void)sync_range(addr, size, (RB_SYNC_FULL == meta->sync) ? MS_SYNC : MS_ASYNC);
+  }
+}
+
+/**
+ * \brief Flushes all changes and unmaps the file.
+ *
+ * Detailed description see in rb_private.h
+ */
+void rb_mapped_release(ring_buffer_t *rb)
+{
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  void *mapping = meta->mapping;
+  size_t mapped_size = meta->mapped_size;
+
+  (void)msync(mapping, mapped_size, MS_SYNC);
+  munmap(mapping, mapped_size);
+
+  free_fn_t mem_free = get_free();
+  mem_free(rb);
+}
+
+/**
+ * \brief Writes all changes of the ring buffer to the disk.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_flush(ring_buffer_t *rb)
+{
+  UC_ASSERT(rb);
+  UC_ASSERT(rb->meta);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  if (RB_STORAGE_FILE != meta->storage)
+  {
+    return true;
+  }
+
+  return 0 == msync(meta->mapping, meta->mapped_size, MS_SYNC);
+}
+#else
+ring_buffer_t *rb_create_mapped(const char *path, size_t size, size_t esize)
+{
+  (void)path;
+  (void)size;
+  (void)esize;
+  return NULL;
+}
+
+void rb_mapped_sync(const rbmeta_t *meta, const void *addr, size_t size)
+{
+  (void)meta;
+  (void)addr;
+  (void)size;
+}
+
+void rb_mapped_release(ring_buffer_t *rb)
+{
+  (void)rb;
+}
+
+bool rb_flush(ring_buffer_t *rb)
+{
+  UC_ASSERT(rb);
+  return true;
+}
+#endif
+
+/**
+ * \brief Sets the policy of flushing the changes of the ring buffer.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_set_sync(ring_buffer_t *rb, rb_sync_t sync)
+{
+  UC_ASSERT(rb);
+  UC_ASSERT(rb->meta);
+  UC_ASSERT(sync <= RB_SYNC_FULL);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  if (RB_STORAGE_FILE != meta->storage)
+  {
+    return false;
+  }
+
+  meta->sync = sync;
+
+  return true;
+}
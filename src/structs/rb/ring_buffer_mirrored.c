@@ -0,0 +1,209 @@
+/**
+ * @file ring_buffer_mirrored.c
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Ring buffer whose storage is mapped twice back to back in the virtual memory.
+ * @date 2026-10-18
+ *
+ * The storage is the anonymous memory object which is mapped into two adjacent ranges of the address space,
+ * so the element which crosses the end of the first range continues in the second one and is contiguous.
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE
+#endif
+
+#include "ring_buffer.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "rb_private.h"
+
+#if RB_USE_MMAP
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Returns the greatest common divisor of `a` and `b`.
+ */
+static size_t gcd(size_t a, size_t b)
+{
+  while (0 != b)
+  {
+    size_t r = a % b;
+    a = b;
+    b = r;
+  }
+
+  return a;
+}
+
+/**
+ * \brief Creates the anonymous memory object of `size` bytes.
+ *
+ * \return Descriptor of the object or -1.
+ */
+static int create_object(size_t size)
+{
+  int fd = -1;
+
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+  fd = memfd_create("uds_rb_mirrored", MFD_CLOEXEC);
+#else
+  char name[64];
+  for (unsigned attempt = 0; attempt < 16 && fd < 0; attempt++)
+  {
+    snprintf(name, sizeof(name), "/uds_rb_%ld_%p_%u", (long)getpid(), (void *)&fd, attempt);
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0)
+    {
+      // Only the descriptor is needed, the name would leak the object after the crash
+      shm_unlink(name);
+    }
+  }
+#endif
+
+  if (fd >= 0 && 0 != ftruncate(fd, (off_t)size))
+  {
+    close(fd);
+    fd = -1;
+  }
+
+  return fd;
+}
+
+/**
+ * \brief Maps the object of `size` bytes twice into the adjacent ranges.
+ *
+ * \return Beginning of the first range or NULL.
+ */
+static uint8_t *map_mirrored(int fd, size_t size)
+{
+  // Reserves the address space for both views so no other mapping can take the second range
+  uint8_t *base = (uint8_t *)mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == (void *)base)
+  {
+    return NULL;
+  }
+
+  if (MAP_FAILED == mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) ||
+      MAP_FAILED == mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0))
+  {
+    munmap(base, 2 * size);
+    return NULL;
+  }
+
+  return base;
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Creates the ring buffer whose storage is mapped twice back to back in the virtual memory.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ring_buffer_t *rb_create_mirrored(size_t size, size_t esize)
+{
+  UC_ASSERT(0 != esize);
+  UC_ASSERT(0 != size);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  // The view can be mapped only at the page boundary, so the storage has to occupy whole pages
+  size_t page = (size_t)sysconf(_SC_PAGESIZE);
+  size_t unit = page / gcd(page, esize);
+
+  if (size > SIZE_MAX - unit + 1)
+  {
+    return NULL;
+  }
+
+  size = (size + unit - 1) / unit * unit;
+  if (size > SIZE_MAX / 2 / esize)
+  {
+    return NULL;
+  }
+
+  size_t bytes = size * esize;
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  ring_buffer_t *rb = (ring_buffer_t *)mem_allocate(sizeof(ring_buffer_t) + sizeof(rbmeta_t) + sizeof(rbindex_t));
+  if (NULL == rb)
+  {
+    return NULL;
+  }
+
+  int fd = create_object(bytes);
+  uint8_t *mapping = (fd >= 0) ? map_mirrored(fd, bytes) : NULL;
+
+  // The views stay valid after the descriptor is closed
+  if (fd >= 0)
+  {
+    close(fd);
+  }
+
+  if (NULL == mapping)
+  {
+    mem_free(rb);
+    return NULL;
+  }
+
+  rb->meta = (void *)((uint8_t *)rb + sizeof(ring_buffer_t));
+  rb->iface = &rb_iface;
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  rbindex_t *index = (rbindex_t *)((uint8_t *)meta + sizeof(rbmeta_t));
+  rb_init_index(index);
+  rb_init_meta(meta, index, size, esize, mapping);
+  meta->storage = RB_STORAGE_MIRRORED;
+  meta->mapping = mapping;
+  meta->mapped_size = 2 * bytes;
+
+  return rb;
+}
+
+/**
+ * \brief Unmaps both views of the mirrored storage.
+ *
+ * Detailed description see in rb_private.h
+ */
+void rb_mirrored_release(ring_buffer_t *rb)
+{
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  munmap(meta->mapping, meta->mapped_size);
+
+  free_fn_t mem_free = get_free();
+  mem_free(rb);
+}
+#else
+ring_buffer_t *rb_create_mirrored(size_t size, size_t esize)
+{
+  (void)size;
+  (void)esize;
+  return NULL;
+}
+
+void rb_mirrored_release(ring_buffer_t *rb)
+{
+  (void)rb;
+}
+#endif
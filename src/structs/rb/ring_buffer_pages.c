@@ -0,0 +1,106 @@
+/**
+ * @file ring_buffer_pages.c
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Ring buffer whose storage is mapped with the selected page size and NUMA node.
+ * @date 2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ring_buffer.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "platform/mem_pages.h"
+#include "rb_private.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates the ring buffer whose storage is mapped with the selected page size and NUMA node.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ring_buffer_t *rb_create_pages(size_t size, size_t esize, const mem_pages_opts_t *opts)
+{
+  UC_ASSERT(0 != esize);
+  UC_ASSERT(0 != size);
+  UC_ASSERT(opts);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  if (size > SIZE_MAX / esize)
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  // Only the storage is mapped, the indexes stay in the heap block with the meta
+  ring_buffer_t *rb = (ring_buffer_t *)mem_allocate(sizeof(ring_buffer_t) + sizeof(rbmeta_t) + sizeof(rbindex_t));
+  if (NULL == rb)
+  {
+    return NULL;
+  }
+
+  size_t mapped_size = 0;
+  uint8_t *data = (uint8_t *)mem_pages_alloc(size * esize, opts, &mapped_size);
+  if (NULL == data)
+  {
+    mem_free(rb);
+    return NULL;
+  }
+
+  rb->meta = (void *)((uint8_t *)rb + sizeof(ring_buffer_t));
+  rb->iface = &rb_iface;
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  rbindex_t *index = (rbindex_t *)((uint8_t *)meta + sizeof(rbmeta_t));
+  rb_init_index(index);
+  rb_init_meta(meta, index, size, esize, data);
+  meta->storage = RB_STORAGE_PAGES;
+  meta->mapping = data;
+  meta->mapped_size = mapped_size;
+
+  return rb;
+}
+
+/**
+ * \brief Unmaps the storage mapped by `mem_pages_alloc`.
+ *
+ * Detailed description see in rb_private.h
+ */
+void rb_pages_release(ring_buffer_t *rb)
+{
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  mem_pages_free(meta->mapping, meta->mapped_size);
+
+  free_fn_t mem_free = get_free();
+  mem_free(rb);
+}
+
+/**
+ * \brief Touches every page of the storage from the calling thread.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+void rb_prefault(ring_buffer_t *rb)
+{
+  UC_ASSERT(rb);
+  UC_ASSERT(rb->meta);
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  mem_pages_touch(meta->data, meta->max_size * meta->esize);
+}
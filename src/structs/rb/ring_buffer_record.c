@@ -0,0 +1,219 @@
+/**
+ * @file ring_buffer_record.c
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Records of variable length stored in the byte ring buffer.
+ * @date 2026-10-18
+ *
+ * Every record is the header with the length of the payload followed by the payload, both aligned to
+ * `RB_RECORD_ALIGN`. The record is never split by the end of the storage: if it doesn't fit into the rest
+ * of the storage, the rest is filled by the padding header and the record is written from the beginning.
+ * The mirrored storage has no end, so the records are always written right after the previous one.
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ring_buffer.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "structs/ds_assert.h"
+#include "rb_private.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/** Length in the header which marks the padding up to the end of the storage */
+#define RB_RECORD_PADDING UINT32_MAX
+
+/**
+ * \brief Header of the record.
+ */
+typedef struct
+{
+  uint32_t length;   /**< Length in bytes of the payload or `RB_RECORD_PADDING` */
+  uint32_t reserved; /**< Keeps the payload aligned to `RB_RECORD_ALIGN` */
+} rbrecord_header_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * \brief Returns the number of bytes occupied by the record with `length` bytes of payload.
+ */
+static inline size_t record_size(size_t length)
+{
+  return (sizeof(rbrecord_header_t) + length + RB_RECORD_ALIGN - 1) & ~(size_t)(RB_RECORD_ALIGN - 1);
+}
+
+/**
+ * \brief Checks that the ring buffer can store records.
+ */
+static inline bool is_byte_buffer(const ring_buffer_t *rb)
+{
+  const rbmeta_t *meta = (const rbmeta_t *)rb->meta;
+
+  return 1 == meta->esize && 0 == meta->max_size % RB_RECORD_ALIGN && !meta->multi_producer &&
+         0 == (uintptr_t)meta->data % RB_RECORD_ALIGN;
+}
+
+/**
+ * \brief Finds the oldest record.
+ *
+ * \param[out] header Header of the oldest record.
+ * \param[out] skip Number of bytes of the padding before the record.
+ * \return true if the ring buffer contains the record, false otherwise.
+ */
+static bool find_record(const ring_buffer_t *rb, const rbrecord_header_t **header, size_t *skip)
+{
+  ds_span_t first;
+  ds_span_t second;
+
+  if (0 == rb_get_spans(rb, &first, &second))
+  {
+    return false;
+  }
+
+  *header = (const rbrecord_header_t *)first.data;
+  *skip = 0;
+
+  if (RB_RECORD_PADDING == (*header)->length)
+  {
+    DS_ASSERT_PARANOID(0 != second.count);
+
+    *header = (const rbrecord_header_t *)second.data;
+    *skip = first.count;
+  }
+
+  DS_ASSERT_PARANOID(record_size((*header)->length) <= first.count + second.count - *skip);
+
+  return true;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Writes the record of variable length to the ring buffer.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_write_record(ring_buffer_t *rb, const void *data, size_t length)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_CHEAP(data || 0 == length);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(is_byte_buffer(rb));
+
+  if (length >= RB_RECORD_PADDING - 2 * RB_RECORD_ALIGN)
+  {
+    return false;
+  }
+
+  ds_span_t first;
+  ds_span_t second;
+  rb_get_free_spans(rb, &first, &second);
+
+  size_t size = record_size(length);
+  size_t skip = 0;
+  uint8_t *slot = (uint8_t *)first.data;
+
+  if (size > first.count)
+  {
+    // Free bytes at the beginning mean that the first span lasts up to the end of the storage
+    if (size > second.count)
+    {
+      return false;
+    }
+
+    ((rbrecord_header_t *)first.data)->length = RB_RECORD_PADDING;
+    skip = first.count;
+    slot = (uint8_t *)second.data;
+  }
+
+  rbrecord_header_t *header = (rbrecord_header_t *)slot;
+  header->length = (uint32_t)length;
+  header->reserved = 0;
+  if (0 != length)
+  {
+    memcpy(slot + sizeof(rbrecord_header_t), data, length);
+  }
+
+  return rb_advance_head(rb, skip + size);
+}
+
+/**
+ * \brief Returns the view of the oldest record without removing it.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_peek_record(const ring_buffer_t *rb, rb_record_t *record)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_CHEAP(record);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(is_byte_buffer(rb));
+
+  const rbrecord_header_t *header;
+  size_t skip;
+
+  if (!find_record(rb, &header, &skip))
+  {
+    return false;
+  }
+
+  record->data = (const uint8_t *)header + sizeof(rbrecord_header_t);
+  record->length = header->length;
+
+  return true;
+}
+
+/**
+ * \brief Removes the oldest record.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_release_record(ring_buffer_t *rb)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_PARANOID(rb->meta);
+  DS_ASSERT_CHEAP(is_byte_buffer(rb));
+
+  const rbrecord_header_t *header;
+  size_t skip;
+
+  if (!find_record(rb, &header, &skip))
+  {
+    return false;
+  }
+
+  return rb_advance_tail(rb, skip + record_size(header->length));
+}
+
+/**
+ * \brief Copies the oldest record and removes it.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_read_record(ring_buffer_t *rb, void *data, size_t size, size_t *length)
+{
+  DS_ASSERT_CHEAP(rb);
+  DS_ASSERT_CHEAP(data || 0 == size);
+  DS_ASSERT_CHEAP(length);
+
+  rb_record_t record;
+
+  if (!rb_peek_record(rb, &record))
+  {
+    *length = 0;
+    return false;
+  }
+
+  *length = record.length;
+  if (record.length > size)
+  {
+    return false;
+  }
+
+  if (0 != record.length)
+  {
+    memcpy(data, record.data, record.length);
+  }
+
+  return rb_release_record(rb);
+}
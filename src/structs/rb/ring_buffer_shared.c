@@ -0,0 +1,271 @@
+/**
+ * @file ring_buffer_shared.c
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Ring buffer placed in the POSIX shared memory for exchange of elements between processes.
+ * @date 2026-10-18
+ *
+ * Layout of the shared memory: header, indexes of the ring buffer (`rbindex_t`) and the storage. Both the
+ * indexes and the storage start at the offsets aligned to the cache line. The shared memory contains only
+ * offsets and indexes, every process keeps its own meta with pointers into its own mapping.
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "ring_buffer.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "rb_private.h"
+
+#if RB_USE_MMAP
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/** Magic number of the shared memory: "UDSH" */
+#define RB_SHARED_MAGIC 0x48534455U
+
+/** Version of the shared memory layout */
+#define RB_SHARED_VERSION 1U
+
+/**
+ * \brief Header of the shared memory.
+ *
+ * The magic number is stored the last one by the creator, so the process which attaches sees either the
+ * complete header or zero magic number.
+ */
+typedef struct
+{
+  atomic_uint_least32_t magic; /**< `RB_SHARED_MAGIC` */
+  uint32_t version;            /**< `RB_SHARED_VERSION` */
+  uint64_t header_size;        /**< Size of the header and the indexes, detects incompatible builds */
+  uint64_t max_size;           /**< Number of slots in the storage */
+  uint64_t esize;              /**< Size in bytes of the single element */
+  uint32_t mode;               /**< `rb_shared_mode_t` */
+} rbshared_header_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Returns the offset of the indexes from the beginning of the shared memory.
+ */
+static size_t index_offset(void)
+{
+  return (sizeof(rbshared_header_t) + RB_CACHE_LINE - 1) & ~(size_t)(RB_CACHE_LINE - 1);
+}
+
+/**
+ * \brief Returns the offset of the storage from the beginning of the shared memory.
+ */
+static size_t data_offset(void)
+{
+  return index_offset() + ((sizeof(rbindex_t) + RB_CACHE_LINE - 1) & ~(size_t)(RB_CACHE_LINE - 1));
+}
+
+/**
+ * \brief Creates the ring buffer which refers to the mapped shared memory.
+ */
+static ring_buffer_t *create_local(uint8_t *mapping, size_t mapped_size)
+{
+  const rbshared_header_t *header = (const rbshared_header_t *)mapping;
+  allocate_fn_t mem_allocate = get_allocator();
+
+  ring_buffer_t *rb = (ring_buffer_t *)mem_allocate(sizeof(ring_buffer_t) + sizeof(rbmeta_t));
+  if (NULL == rb)
+  {
+    return NULL;
+  }
+
+  rb->meta = (void *)((uint8_t *)rb + sizeof(ring_buffer_t));
+  rb->iface = &rb_iface;
+
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+  rb_init_meta(meta, (rbindex_t *)(mapping + index_offset()), (size_t)header->max_size, (size_t)header->esize,
+               mapping + data_offset());
+  meta->storage = RB_STORAGE_SHARED;
+  meta->multi_producer = (RB_SHARED_MPSC == header->mode);
+  meta->mapping = mapping;
+  meta->mapped_size = mapped_size;
+
+  return rb;
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+#if RB_USE_MMAP
+/**
+ * \brief Creates the ring buffer placed in the new shared memory object.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ring_buffer_t *rb_create_shared(const char *name, size_t size, size_t esize, rb_shared_mode_t mode)
+{
+  UC_ASSERT(name);
+  UC_ASSERT(0 != esize);
+  UC_ASSERT(0 != size);
+  UC_ASSERT(mode <= RB_SHARED_MPSC);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  if (size > (SIZE_MAX - data_offset()) / esize || data_offset() + size * esize > (uint64_t)INT64_MAX)
+  {
+    return NULL;
+  }
+
+  size_t mapped_size = data_offset() + size * esize;
+
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0)
+  {
+    return NULL;
+  }
+
+  void *mapping = MAP_FAILED;
+  if (0 == ftruncate(fd, (off_t)mapped_size))
+  {
+    mapping = mmap(NULL, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+
+  if (MAP_FAILED == mapping)
+  {
+    shm_unlink(name);
+    return NULL;
+  }
+
+  rbshared_header_t *header = (rbshared_header_t *)mapping;
+  header->version = RB_SHARED_VERSION;
+  header->header_size = sizeof(rbshared_header_t) + sizeof(rbindex_t);
+  header->max_size = size;
+  header->esize = esize;
+  header->mode = (uint32_t)mode;
+  rb_init_index((rbindex_t *)((uint8_t *)mapping + index_offset()));
+  atomic_store_explicit(&header->magic, RB_SHARED_MAGIC, memory_order_release);
+
+  ring_buffer_t *rb = create_local((uint8_t *)mapping, mapped_size);
+  if (NULL == rb)
+  {
+    munmap(mapping, mapped_size);
+    shm_unlink(name);
+  }
+
+  return rb;
+}
+
+/**
+ * \brief Attaches to the ring buffer placed in the shared memory object.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+ring_buffer_t *rb_attach_shared(const char *name)
+{
+  UC_ASSERT(name);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  int fd = shm_open(name, O_RDWR, 0);
+  if (fd < 0)
+  {
+    return NULL;
+  }
+
+  struct stat st;
+  void *mapping = MAP_FAILED;
+  size_t mapped_size = 0;
+
+  if (0 == fstat(fd, &st) && (uint64_t)st.st_size >= (uint64_t)data_offset())
+  {
+    mapped_size = (size_t)st.st_size;
+    mapping = mmap(NULL, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+
+  if (MAP_FAILED == mapping)
+  {
+    return NULL;
+  }
+
+  const rbshared_header_t *header = (const rbshared_header_t *)mapping;
+  bool valid = RB_SHARED_MAGIC == atomic_load_explicit(&header->magic, memory_order_acquire) &&
+               RB_SHARED_VERSION == header->version &&
+               sizeof(rbshared_header_t) + sizeof(rbindex_t) == header->header_size &&
+               0 != header->esize && 0 != header->max_size && header->mode <= RB_SHARED_MPSC &&
+               header->max_size <= (mapped_size - data_offset()) / header->esize &&
+               data_offset() + header->max_size * header->esize == mapped_size;
+
+  ring_buffer_t *rb = valid ? create_local((uint8_t *)mapping, mapped_size) : NULL;
+  if (NULL == rb)
+  {
+    munmap(mapping, mapped_size);
+  }
+
+  return rb;
+}
+
+/**
+ * \brief Removes the name of the shared memory object.
+ *
+ * Detailed description see in ring_buffer.h
+ */
+bool rb_unlink_shared(const char *name)
+{
+  UC_ASSERT(name);
+
+  return 0 == shm_unlink(name);
+}
+
+/**
+ * \brief Unmaps the shared memory object.
+ *
+ * Detailed description see in rb_private.h
+ */
+void rb_shared_release(ring_buffer_t *rb)
+{
+  rbmeta_t *meta = (rbmeta_t *)rb->meta;
+
+  munmap(meta->mapping, meta->mapped_size);
+
+  free_fn_t mem_free = get_free();
+  mem_free(rb);
+}
+#else
+ring_buffer_t *rb_create_shared(const char *name, size_t size, size_t esize, rb_shared_mode_t mode)
+{
+  (void)name;
+  (void)size;
+  (void)esize;
+  (void)mode;
+  return NULL;
+}
+
+ring_buffer_t *rb_attach_shared(const char *name)
+{
+  (void)name;
+  return NULL;
+}
+
+bool rb_unlink_shared(const char *name)
+{
+  (void)name;
+  return false;
+}
+
+void rb_shared_release(ring_buffer_t *rb)
+{
+  (void)rb;
+}
+#endif
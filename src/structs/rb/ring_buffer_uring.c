@@ -0,0 +1,608 @@
+/**
+ * @file ring_buffer_uring.c
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Asynchronous transfer of the ring buffer from and to the file descriptors by io_uring.
+ * @date 2026-10-18
+ *
+ * io_uring is used through the raw system calls and the rings mapped from the kernel, so the module doesn't
+ * depend on liburing. The requests of every direction are kept in the FIFO in the order of queueing: the kernel
+ * may complete them in any order, but the head and the tail are advanced only by the oldest completed request.
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE
+#endif
+
+#include "ring_buffer_uring.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/uc_assert.h"
+#include "interface/allocator_if.h"
+#include "rb_private.h"
+#include "structs/ds_assert.h"
+//_____ C O N F I G S  ________________________________________________________
+/** Set to 0 to build the library without io_uring, `rb_uring_create` then returns NULL */
+#ifndef RB_USE_URING
+  #if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+      #define RB_USE_URING 1
+    #endif
+  #endif
+#endif
+
+#ifndef RB_USE_URING
+  #define RB_USE_URING 0
+#endif
+
+#if RB_USE_URING
+  #include <linux/io_uring.h>
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <sys/uio.h>
+  #include <unistd.h>
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+#if RB_USE_URING
+/** Directions of the requests, index of the FIFO */
+enum
+{
+  RB_URING_READ = 0,
+  RB_URING_WRITE,
+  RB_URING_DIRS,
+};
+
+/**
+ * \brief Request queued or in flight.
+ */
+typedef struct
+{
+  int fd;           /**< Descriptor of the file */
+  int64_t offset;   /**< Offset in the file or -1 */
+  size_t length;    /**< Requested number of bytes */
+  ptrdiff_t result; /**< Result of the completion */
+  bool completed;   /**< Completion was received */
+  struct iovec iov; /**< Vector of the request without the fixed buffer, must live until the completion */
+} rb_uring_req_t;
+
+/**
+ * \brief Requests of one direction in the order of queueing.
+ */
+typedef struct
+{
+  rb_uring_req_t *reqs; /**< Cyclic array of `entries` requests */
+  unsigned first;       /**< Index of the oldest request */
+  unsigned count;       /**< Number of requests */
+  size_t claimed;       /**< Bytes claimed by the requests after the head or the tail */
+  bool cancel;          /**< The short request was retired, the rest are discarded */
+} rb_uring_fifo_t;
+
+struct RbUring_t
+{
+  ring_buffer_t *rb;                   /**< Ring buffer */
+  int fd;                              /**< Descriptor of io_uring */
+  bool fixed;                          /**< Storage is registered as the fixed buffer 0 */
+  unsigned entries;                    /**< Max number of requests in flight */
+  unsigned queued;                     /**< Number of requests which are not submitted yet */
+  unsigned uncompleted;                /**< Number of requests whose completion isn't received yet */
+  uint8_t *sq_ring;                    /**< Mapped ring of the submissions */
+  size_t sq_ring_size;                 /**< Size in bytes of `sq_ring` */
+  atomic_uint *sq_tail;                /**< Tail of the submissions, written by the application */
+  unsigned sq_mask;                    /**< Mask of the indexes of the submissions */
+  unsigned *sq_array;                  /**< Indexes of the entries of the submissions */
+  struct io_uring_sqe *sqes;           /**< Mapped entries of the submissions */
+  size_t sqes_size;                    /**< Size in bytes of `sqes` */
+  uint8_t *cq_ring;                    /**< Mapped ring of the completions */
+  size_t cq_ring_size;                 /**< Size in bytes of `cq_ring` */
+  atomic_uint *cq_head;                /**< Head of the completions, written by the application */
+  atomic_uint *cq_tail;                /**< Tail of the completions, written by the kernel */
+  unsigned cq_mask;                    /**< Mask of the indexes of the completions */
+  struct io_uring_cqe *cqes;           /**< Entries of the completions */
+  rb_uring_fifo_t fifo[RB_URING_DIRS]; /**< Requests of both directions */
+};
+#endif
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if RB_USE_URING
+/**
+ * \brief Wrappers of the system calls of io_uring, which have no wrappers in libc.
+ */
+static int uring_setup(unsigned entries, struct io_uring_params *params)
+{
+  return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int uring_enter(int fd, unsigned submit, unsigned wait, unsigned flags)
+{
+  return (int)syscall(__NR_io_uring_enter, fd, submit, wait, flags, NULL, 0);
+}
+
+static int uring_register(int fd, unsigned opcode, const void *arg, unsigned count)
+{
+  return (int)syscall(__NR_io_uring_register, fd, opcode, arg, count);
+}
+
+/**
+ * \brief Maps the rings of io_uring described by `params`.
+ */
+static bool map_rings(rb_uring_t *uring, const struct io_uring_params *params)
+{
+  uring->sq_ring_size = params->sq_off.array + params->sq_entries * sizeof(unsigned);
+  uring->cq_ring_size = params->cq_off.cqes + params->cq_entries * sizeof(struct io_uring_cqe);
+  uring->sqes_size = params->sq_entries * sizeof(struct io_uring_sqe);
+
+  uring->sq_ring = (uint8_t *)mmap(NULL, uring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                   uring->fd, IORING_OFF_SQ_RING);
+  uring->cq_ring = (uint8_t *)mmap(NULL, uring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                   uring->fd, IORING_OFF_CQ_RING);
+  uring->sqes = (struct io_uring_sqe *)mmap(NULL, uring->sqes_size, PROT_READ | PROT_WRITE,
+                                            MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQES);
+
+  if (MAP_FAILED == (void *)uring->sq_ring || MAP_FAILED == (void *)uring->cq_ring ||
+      MAP_FAILED == (void *)uring->sqes)
+  {
+    return false;
+  }
+
+  uring->sq_tail = (atomic_uint *)(uring->sq_ring + params->sq_off.tail);
+  uring->sq_mask = *(unsigned *)(uring->sq_ring + params->sq_off.ring_mask);
+  uring->sq_array = (unsigned *)(uring->sq_ring + params->sq_off.array);
+  uring->cq_head = (atomic_uint *)(uring->cq_ring + params->cq_off.head);
+  uring->cq_tail = (atomic_uint *)(uring->cq_ring + params->cq_off.tail);
+  uring->cq_mask = *(unsigned *)(uring->cq_ring + params->cq_off.ring_mask);
+  uring->cqes = (struct io_uring_cqe *)(uring->cq_ring + params->cq_off.cqes);
+
+  return true;
+}
+
+/**
+ * \brief Unmaps the rings and closes io_uring.
+ */
+static void release_rings(rb_uring_t *uring)
+{
+  if (NULL != uring->sqes && MAP_FAILED != (void *)uring->sqes)
+  {
+    munmap(uring->sqes, uring->sqes_size);
+  }
+  if (NULL != uring->cq_ring && MAP_FAILED != (void *)uring->cq_ring)
+  {
+    munmap(uring->cq_ring, uring->cq_ring_size);
+  }
+  if (NULL != uring->sq_ring && MAP_FAILED != (void *)uring->sq_ring)
+  {
+    munmap(uring->sq_ring, uring->sq_ring_size);
+  }
+
+  close(uring->fd);
+}
+
+/**
+ * \brief Registers the storage of the ring buffer, both views of the mirrored one.
+ */
+static bool register_storage(rb_uring_t *uring)
+{
+  const rbmeta_t *meta = (const rbmeta_t *)uring->rb->meta;
+  struct iovec iov;
+
+  if (RB_STORAGE_MIRRORED == meta->storage)
+  {
+    iov.iov_base = meta->mapping;
+    iov.iov_len = meta->mapped_size;
+  }
+  else
+  {
+    iov.iov_base = meta->data;
+    iov.iov_len = meta->max_size * meta->esize;
+  }
+
+  return 0 == uring_register(uring->fd, IORING_REGISTER_BUFFERS, &iov, 1);
+}
+
+/**
+ * \brief Returns the total number of requests of both directions.
+ */
+static unsigned pending(const rb_uring_t *uring)
+{
+  return uring->fifo[RB_URING_READ].count + uring->fifo[RB_URING_WRITE].count;
+}
+
+/**
+ * \brief Finds the contiguous range of the spans which follows the first `skip` bytes.
+ *
+ * \return Length in bytes of the range, at most `max`, or 0 if the spans are shorter than `skip`.
+ */
+static size_t next_range(const ds_span_t spans[2], size_t esize, size_t skip, size_t max, uint8_t **addr)
+{
+  for (size_t i = 0; i < 2; i++)
+  {
+    size_t bytes = spans[i].count * esize;
+    if (skip < bytes)
+    {
+      *addr = (uint8_t *)spans[i].data + skip;
+      bytes -= skip;
+      return (bytes < max) ? bytes : max;
+    }
+    skip -= bytes;
+  }
+
+  return 0;
+}
+
+/**
+ * \brief Queues the request of the direction for the range of the storage.
+ */
+static bool queue_request(rb_uring_t *uring, unsigned dir, int fd, size_t max, int64_t offset)
+{
+  rbmeta_t *meta = (rbmeta_t *)uring->rb->meta;
+  rb_uring_fifo_t *fifo = &uring->fifo[dir];
+
+  if (0 == max || fifo->cancel || pending(uring) >= uring->entries)
+  {
+    return false;
+  }
+
+  ds_span_t spans[2];
+  size_t skip = fifo->claimed;
+  if (RB_URING_READ == dir)
+  {
+    rb_get_free_spans(uring->rb, &spans[0], &spans[1]);
+    skip += meta->io_head;
+  }
+  else
+  {
+    rb_get_spans(uring->rb, &spans[0], &spans[1]);
+    skip += meta->io_tail;
+  }
+
+  uint8_t *addr = NULL;
+  size_t length = next_range(spans, meta->esize, skip, (max > UINT32_MAX) ? UINT32_MAX : max, &addr);
+  if (0 == length)
+  {
+    return false;
+  }
+
+  unsigned slot = (fifo->first + fifo->count) % uring->entries;
+  rb_uring_req_t *req = &fifo->reqs[slot];
+  req->fd = fd;
+  req->offset = offset;
+  req->length = length;
+  req->result = 0;
+  req->completed = false;
+  req->iov.iov_base = addr;
+  req->iov.iov_len = length;
+
+  unsigned tail = atomic_load_explicit(uring->sq_tail, memory_order_relaxed);
+  unsigned index = tail & uring->sq_mask;
+  struct io_uring_sqe *sqe = &uring->sqes[index];
+
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->fd = fd;
+  sqe->off = (uint64_t)offset;
+  sqe->user_data = ((uint64_t)dir << 32) | slot;
+  if (uring->fixed)
+  {
+    sqe->opcode = (RB_URING_READ == dir) ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+    sqe->addr = (uint64_t)(uintptr_t)addr;
+    sqe->len = (uint32_t)length;
+    sqe->buf_index = 0;
+  }
+  else
+  {
+    sqe->opcode = (RB_URING_READ == dir) ? IORING_OP_READV : IORING_OP_WRITEV;
+    sqe->addr = (uint64_t)(uintptr_t)&req->iov;
+    sqe->len = 1;
+  }
+
+  uring->sq_array[index] = index;
+  atomic_store_explicit(uring->sq_tail, tail + 1, memory_order_release);
+
+  fifo->count++;
+  fifo->claimed += length;
+  uring->queued++;
+  uring->uncompleted++;
+
+  return true;
+}
+
+/**
+ * \brief Reads the completions and stores their results in the requests.
+ */
+static void reap(rb_uring_t *uring)
+{
+  unsigned head = atomic_load_explicit(uring->cq_head, memory_order_relaxed);
+  unsigned tail = atomic_load_explicit(uring->cq_tail, memory_order_acquire);
+
+  for (; head != tail; head++)
+  {
+    const struct io_uring_cqe *cqe = &uring->cqes[head & uring->cq_mask];
+    unsigned dir = (unsigned)(cqe->user_data >> 32);
+    unsigned slot = (unsigned)(cqe->user_data & UINT32_MAX);
+
+    rb_uring_req_t *req = &uring->fifo[dir].reqs[slot];
+    req->result = cqe->res;
+    req->completed = true;
+    uring->uncompleted--;
+  }
+
+  atomic_store_explicit(uring->cq_head, head, memory_order_release);
+}
+
+/**
+ * \brief Retires the oldest request of the direction, advancing the head or the tail by its result.
+ */
+static void retire(rb_uring_t *uring, unsigned dir, rb_uring_done_t *done)
+{
+  rbmeta_t *meta = (rbmeta_t *)uring->rb->meta;
+  rb_uring_fifo_t *fifo = &uring->fifo[dir];
+  rb_uring_req_t *req = &fifo->reqs[fifo->first];
+
+  ptrdiff_t result = fifo->cancel ? -ECANCELED : req->result;
+
+  if (result > 0)
+  {
+    size_t *partial = (RB_URING_READ == dir) ? &meta->io_head : &meta->io_tail;
+    size_t total = *partial + (size_t)result;
+    *partial = total % meta->esize;
+
+    if (total >= meta->esize)
+    {
+      if (RB_URING_READ == dir)
+      {
+        rb_advance_head(uring->rb, total / meta->esize);
+      }
+      else
+      {
+        rb_advance_tail(uring->rb, total / meta->esize);
+      }
+    }
+  }
+
+  // The data of the next requests doesn't follow the transferred bytes
+  if (result < (ptrdiff_t)req->length && fifo->count > 1)
+  {
+    fifo->cancel = true;
+  }
+
+  if (NULL != done)
+  {
+    done->write = (RB_URING_WRITE == dir);
+    done->fd = req->fd;
+    done->offset = req->offset;
+    done->length = req->length;
+    done->result = result;
+  }
+
+  fifo->claimed -= req->length;
+  fifo->first = (fifo->first + 1) % uring->entries;
+  fifo->count--;
+
+  if (0 == fifo->count)
+  {
+    fifo->cancel = false;
+  }
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+#if RB_USE_URING
+/**
+ * \brief Creates io_uring for the ring buffer and registers its storage.
+ *
+ * Detailed description see in ring_buffer_uring.h
+ */
+rb_uring_t *rb_uring_create(ring_buffer_t *rb, unsigned entries)
+{
+  UC_ASSERT(rb);
+  UC_ASSERT(rb->meta);
+  UC_ASSERT(0 != entries);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  size_t size = sizeof(rb_uring_t) + RB_URING_DIRS * entries * sizeof(rb_uring_req_t);
+  rb_uring_t *uring = (rb_uring_t *)mem_allocate(size);
+  if (NULL == uring)
+  {
+    return NULL;
+  }
+
+  memset(uring, 0, size);
+  uring->rb = rb;
+  uring->entries = entries;
+  uring->fifo[RB_URING_READ].reqs = (rb_uring_req_t *)((uint8_t *)uring + sizeof(rb_uring_t));
+  uring->fifo[RB_URING_WRITE].reqs = uring->fifo[RB_URING_READ].reqs + entries;
+
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+
+  uring->fd = uring_setup(entries, &params);
+  if (uring->fd < 0)
+  {
+    mem_free(uring);
+    return NULL;
+  }
+
+  if (!map_rings(uring, &params))
+  {
+    release_rings(uring);
+    mem_free(uring);
+    return NULL;
+  }
+
+  // The kernel rounds the number of entries up, but the requests are limited by the passed number
+  if (uring->entries > params.sq_entries)
+  {
+    uring->entries = params.sq_entries;
+  }
+
+  uring->fixed = register_storage(uring);
+
+  return uring;
+}
+
+/**
+ * \brief Waits for all requests in flight and frees up the memory associated with io_uring.
+ *
+ * Detailed description see in ring_buffer_uring.h
+ */
+void rb_uring_delete(rb_uring_t **uring)
+{
+  UC_ASSERT(uring);
+  UC_ASSERT(*uring);
+
+  // The kernel may still write into the storage, so the requests have to be completed
+  while (pending(*uring) > 0)
+  {
+    if (rb_uring_complete(*uring, pending(*uring), NULL, SIZE_MAX) < 0)
+    {
+      break;
+    }
+  }
+
+  release_rings(*uring);
+
+  free_fn_t mem_free = get_free();
+  mem_free(*uring);
+  *uring = NULL;
+}
+
+/**
+ * \brief Queues the read from the descriptor into the free slots of the ring buffer.
+ *
+ * Detailed description see in ring_buffer_uring.h
+ */
+bool rb_uring_read(rb_uring_t *uring, int fd, size_t max, int64_t offset)
+{
+  DS_ASSERT_CHEAP(uring);
+
+  return queue_request(uring, RB_URING_READ, fd, max, offset);
+}
+
+/**
+ * \brief Queues the write of the elements of the ring buffer to the descriptor.
+ *
+ * Detailed description see in ring_buffer_uring.h
+ */
+bool rb_uring_write(rb_uring_t *uring, int fd, size_t max, int64_t offset)
+{
+  DS_ASSERT_CHEAP(uring);
+
+  return queue_request(uring, RB_URING_WRITE, fd, max, offset);
+}
+
+/**
+ * \brief Submits the queued requests and retires the completed ones.
+ *
+ * Detailed description see in ring_buffer_uring.h
+ */
+ptrdiff_t rb_uring_complete(rb_uring_t *uring, unsigned wait, rb_uring_done_t *done, size_t max)
+{
+  DS_ASSERT_CHEAP(uring);
+
+  // The requests which are completed but not retired yet would never deliver the awaited completions
+  if (wait > uring->uncompleted)
+  {
+    wait = uring->uncompleted;
+  }
+
+  if (uring->queued > 0 || wait > 0)
+  {
+    int rc;
+    do
+    {
+      rc = uring_enter(uring->fd, uring->queued, wait, (wait > 0) ? IORING_ENTER_GETEVENTS : 0);
+    } while (rc < 0 && EINTR == errno);
+
+    if (rc < 0)
+    {
+      return -1;
+    }
+
+    uring->queued -= (unsigned)rc;
+  }
+
+  reap(uring);
+
+  size_t retired = 0;
+  for (unsigned dir = 0; dir < RB_URING_DIRS; dir++)
+  {
+    rb_uring_fifo_t *fifo = &uring->fifo[dir];
+
+    while (retired < max && fifo->count > 0 && fifo->reqs[fifo->first].completed)
+    {
+      retire(uring, dir, (NULL != done) ? &done[retired] : NULL);
+      retired++;
+    }
+  }
+
+  return (ptrdiff_t)retired;
+}
+
+/**
+ * \brief Returns the number of requests which are queued or in flight.
+ *
+ * Detailed description see in ring_buffer_uring.h
+ */
+size_t rb_uring_pending(const rb_uring_t *uring)
+{
+  DS_ASSERT_CHEAP(uring);
+
+  return pending(uring);
+}
+#else
+rb_uring_t *rb_uring_create(ring_buffer_t *rb, unsigned entries)
+{
+  (void)rb;
+  (void)entries;
+  return NULL;
+}
+
+void rb_uring_delete(rb_uring_t **uring)
+{
+  (void)uring;
+}
+
+bool rb_uring_read(rb_uring_t *uring, int fd, size_t max, int64_t offset)
+{
+  (void)uring;
+  (void)fd;
+  (void)max;
+  (void)offset;
+  return false;
+}
+
+bool rb_uring_write(rb_uring_t *uring, int fd, size_t max, int64_t offset)
+{
+  (void)uring;
+  (void)fd;
+  (void)max;
+  (void)offset;
+  return false;
+}
+
+ptrdiff_t rb_uring_complete(rb_uring_t *uring, unsigned wait, rb_uring_done_t *done, size_t max)
+{
+  (void)uring;
+  (void)wait;
+  (void)done;
+  (void)max;
+  errno = ENOSYS;
+  return -1;
+}
+
+size_t rb_uring_pending(const rb_uring_t *uring)
+{
+  (void)uring;
+  return 0;
+}
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file ring_buffer_uring.h
+ * @author Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief Asynchronous transfer of the ring buffer from and to the file descriptors by io_uring.
+ * @date 2026-10-18
+ *
+ * The storage of the ring buffer is registered as the fixed buffer of io_uring, so the kernel reads the data
+ * directly into the free slots and writes the elements directly from the storage without pinning the pages
+ * for every request. Several reads and writes can be queued and submitted by the single system call:
+ *
+ * - `rb_uring_read` queues the read into the next free bytes which are not claimed by the queued reads;
+ * - `rb_uring_write` queues the write of the next elements which are not claimed by the queued writes;
+ * - `rb_uring_complete` submits the queued requests, waits for the completions and retires them in the order
+ *   of queueing, advancing the head by the read bytes and the tail by the written ones.
+ *
+ * If the request transfers less than requested, e.g. at the end of file, the requests of the same direction
+ * queued after it are retired with `-ECANCELED` and their data is discarded, so the elements always stay
+ * contiguous. Several requests in flight are intended for regular files with explicit offsets; the pipes and
+ * the sockets should have only one request per direction in flight, since the kernel may complete them in any
+ * order. The ring buffer must not be changed by other functions of the same direction while its requests are
+ * in flight.
+ *
+ * The module is built only on Linux (`RB_USE_URING`), otherwise `rb_uring_create` returns NULL. If the kernel
+ * refuses to register the storage, e.g. because of the limit of the locked memory, the requests are submitted
+ * as vectored ones without the fixed buffer.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct RbUring_t rb_uring_t;
+
+/**
+ * \brief Result of the retired request.
+ */
+typedef struct
+{
+  bool write;       /**< true for the write, false for the read */
+  int fd;           /**< Descriptor passed to `rb_uring_read`/`rb_uring_write` */
+  int64_t offset;   /**< Offset in the file passed to `rb_uring_read`/`rb_uring_write` */
+  size_t length;    /**< Requested number of bytes */
+  ptrdiff_t result; /**< Transferred number of bytes, 0 at the end of file or negative `errno` */
+} rb_uring_done_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Creates io_uring for the ring buffer and registers its storage.
+ *
+ * \param[in] rb Pointer to the ring buffer. It has to outlive the returned object.
+ * \param[in] entries Max number of requests in flight.
+ * \return Pointer to the new object or NULL if io_uring isn't supported or there is no memory.
+ */
+rb_uring_t *rb_uring_create(ring_buffer_t *rb, unsigned entries);
+
+/**
+ * \brief Waits for all requests in flight and frees up the memory associated with io_uring.
+ *
+ * \param[in] uring Double pointer to the object.
+ */
+void rb_uring_delete(rb_uring_t **uring);
+
+/**
+ * \brief Queues the read from the descriptor into the free slots of the ring buffer.
+ *
+ * The read never crosses the end of the storage, except the mirrored one, so it may request less than `max`.
+ *
+ * \param[in] uring Pointer to the object.
+ * \param[in] fd Descriptor of the file or the pipe.
+ * \param[in] max Max number of bytes to read.
+ * \param[in] offset Offset in the file or -1 for the current position.
+ * \return true if the read was queued, false if there are no unclaimed free slots, too many requests are in
+ *         flight or the reads after the short one are not retired yet.
+ */
+bool rb_uring_read(rb_uring_t *uring, int fd, size_t max, int64_t offset);
+
+/**
+ * \brief Queues the write of the elements of the ring buffer to the descriptor.
+ *
+ * The write never crosses the end of the storage, except the mirrored one, so it may request less than `max`.
+ *
+ * \param[in] uring Pointer to the object.
+ * \param[in] fd Descriptor of the file or the pipe.
+ * \param[in] max Max number of bytes to write.
+ * \param[in] offset Offset in the file or -1 for the current position.
+ * \return true if the write was queued, false if there are no unclaimed elements, too many requests are in
+ *         flight or the writes after the short one are not retired yet.
+ */
+bool rb_uring_write(rb_uring_t *uring, int fd, size_t max, int64_t offset);
+
+/**
+ * \brief Submits the queued requests and retires the completed ones.
+ *
+ * \param[in] uring Pointer to the object.
+ * \param[in] wait Number of completions to wait for, limited by the number of requests whose completions aren't
+ *                 received yet.
+ * \param[out] done Array for the results of the retired requests or NULL.
+ * \param[in] max Max number of requests to retire.
+ * \return Number of retired requests or -1 on error of the system call with `errno` set.
+ */
+ptrdiff_t rb_uring_complete(rb_uring_t *uring, unsigned wait, rb_uring_done_t *done, size_t max);
+
+/**
+ * \brief Returns the number of requests which are queued or in flight.
+ *
+ * \param[in] uring Pointer to the object.
+ * \return Number of requests.
+ */
+size_t rb_uring_pending(const rb_uring_t *uring);
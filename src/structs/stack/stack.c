@@ -9,74 +9,248 @@
 #include "stack.h"
 
 #include "common/uc_assert.h"
+#include "structs/ds_assert.h"
+#include "structs/ds_copy.h"
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "interface/allocator_if.h"
 
 //_____ C O N F I G S  ________________________________________________________
+/** Number of elements allocated on the heap at the first spill of the stack */
+#ifndef STACK_INITIAL_ALLOCATED
+  #define STACK_INITIAL_ALLOCATED 8
+#endif
 //_____ D E F I N I T I O N S _________________________________________________
 typedef struct
 {
-  size_t capacity;
+  size_t capacity;  /**< Max number of elements or 0 if the stack is unlimited */
+  size_t esize;     /**< Size in bytes of the single element */
+  size_t count;     /**< Current number of elements */
+  size_t allocated; /**< Number of elements which fit into the current storage */
+  size_t inlined;   /**< Number of elements which fit into the inline buffer */
+  stack_growth_t growth; /**< Growth policy of the heap storage */
+  size_t step;      /**< Growth factor or increment depending on `growth` */
+  size_t shrink;    /**< Ratio of `allocated` to `count` which triggers automatic shrinking or 0 */
+  ds_copy_fn_t copy; /**< Copy kernel for the size of element */
+  uint8_t *data;    /**< Current storage: `buffer` or block on the heap */
+  _Alignas(max_align_t) uint8_t buffer[]; /**< Inline storage placed right after the meta, aligned for any type */
 } smeta_t;
 //_____ M A C R O S ___________________________________________________________
+/** Offset of the meta from the beginning of the memory block of the stack, it keeps the inline buffer aligned */
+#define META_OFFSET (((sizeof(stack_t) + _Alignof(smeta_t) - 1) / _Alignof(smeta_t)) * _Alignof(smeta_t))
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P R I V A T E  F U N C T I O N S_______________________________________
-//_____ P U B L I C  F U N C T I O N S_________________________________________
 /**
- * \brief Initializes and returns a new stack.
+ * \brief Checks if the stack keeps elements in the heap block.
+ */
+static inline bool is_spilled(const smeta_t *meta)
+{
+  return meta->data != meta->buffer;
+}
+
+/**
+ * \brief Moves the elements of the stack into the storage which can hold `allocated` elements.
  *
- * Detailed description see in stack.h
+ * The inline buffer is used if it is big enough, otherwise the new heap block is allocated.
  */
-stack_t *stack_create(size_t size, size_t esize)
+static bool resize(smeta_t *meta, size_t allocated)
 {
-  UC_ASSERT(0 != esize);
+  UC_ASSERT(allocated >= meta->count);
 
-  if (!is_allocator_valid())
+  free_fn_t mem_free = get_free();
+
+  if (allocated <= meta->inlined)
   {
-    return NULL;
+    if (is_spilled(meta))
+    {
+      memcpy(meta->buffer, meta->data, meta->count * meta->esize);
+      mem_free(meta->data);
+      meta->data = meta->buffer;
+      meta->allocated = meta->inlined;
+    }
+
+    return true;
+  }
+
+  if (allocated > SIZE_MAX / meta->esize)
+  {
+    return false;
   }
 
   allocate_fn_t mem_allocate = get_allocator();
-  free_fn_t mem_free = get_free();
 
-  stack_t *stack = (stack_t *)mem_allocate(sizeof(stack_t));
-  if (NULL == stack)
+  uint8_t *data = (uint8_t *)mem_allocate(allocated * meta->esize);
+  if (NULL == data)
   {
-    return NULL;
+    return false;
   }
 
-  stack->container = container_create(esize, CONTAINER_VECTOR_BASED);
-  if (NULL == stack->container)
+  memcpy(data, meta->data, meta->count * meta->esize);
+
+  if (is_spilled(meta))
   {
-    mem_free(stack);
-    return NULL;
+    mem_free(meta->data);
+  }
+
+  meta->data = data;
+  meta->allocated = allocated;
+
+  return true;
+}
+
+/**
+ * \brief Enlarges the storage of the full stack according to its growth policy.
+ */
+static bool grow(smeta_t *meta)
+{
+  size_t allocated = 0;
+
+  switch (meta->growth)
+  {
+    case STACK_GROWTH_GEOMETRIC:
+      if (meta->allocated > SIZE_MAX / meta->step)
+      {
+        return false;
+      }
+      allocated = (0 != meta->allocated) ? meta->allocated * meta->step : STACK_INITIAL_ALLOCATED;
+      break;
+    case STACK_GROWTH_LINEAR:
+      allocated = meta->allocated + meta->step;
+      break;
+    case STACK_GROWTH_NONE:
+    default:
+      return false;
+  }
+
+  if (allocated <= meta->allocated)
+  {
+    return false;
+  }
+
+  if (0 != meta->capacity && allocated > meta->capacity)
+  {
+    allocated = meta->capacity;
   }
 
-  // stack->private = (void *)mem_allocate(sizeof(smeta_t));
-  // if (NULL == stack->private)
-  // {
-  //   container_delete(&stack->container);
-  //   mem_free(stack);
-  //   return NULL;
-  // }
+  return resize(meta, allocated);
+}
 
-  // smeta_t *stack_priv = (smeta_t *)stack->private;
-  // stack_priv->capacity = size;
+/**
+ * \brief Releases the part of the heap block if the stack uses too little of it.
+ */
+static void autoshrink(smeta_t *meta)
+{
+  if (0 == meta->shrink || STACK_GROWTH_NONE == meta->growth || !is_spilled(meta))
+  {
+    return;
+  }
 
-  // // stack->capacity = size;
+  if (meta->count > meta->allocated / meta->shrink)
+  {
+    return;
+  }
 
-  stack->meta = (void *)mem_allocate(sizeof(smeta_t));
-  if (NULL == stack->meta)
+  size_t allocated = (meta->count > STACK_INITIAL_ALLOCATED / 2) ? meta->count * 2 : STACK_INITIAL_ALLOCATED;
+  if (allocated < meta->allocated)
+  {
+    // Failure is not an error here: the stack just keeps the current block
+    (void)resize(meta, allocated);
+  }
+}
+
+/**
+ * \brief Returns size of the single element of the stack for `ds_t` interface.
+ */
+static size_t ds_esize(const ds_t *ds)
+{
+  return ((const smeta_t *)ds->meta)->esize;
+}
+
+/**
+ * \brief Returns all elements of the stack from the bottom to the top as a single span for `ds_t` interface.
+ */
+static bool ds_next_span(const ds_t *ds, void **pos, ds_span_t *span)
+{
+  const smeta_t *meta = (const smeta_t *)ds->meta;
+
+  if (NULL != *pos || 0 == meta->count)
+  {
+    return false;
+  }
+
+  span->data = meta->data;
+  span->count = meta->count;
+  *pos = meta->data;
+
+  return true;
+}
+
+/**
+ * \brief Returns max number of elements of the stack for `ds_t` interface.
+ */
+static size_t ds_capacity(const ds_t *ds)
+{
+  return ((const smeta_t *)ds->meta)->capacity;
+}
+
+static const ds_iface_t stack_iface = {
+  .esize = ds_esize,
+  .next_span = ds_next_span,
+  .capacity = ds_capacity,
+  .kind = DS_KIND_STACK,
+};
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Initializes and returns a new stack.
+ *
+ * Detailed description see in stack.h
+ */
+stack_t *stack_create(size_t size, size_t esize)
+{
+  return stack_create_inline(size, esize, 0);
+}
+
+/**
+ * \brief Initializes and returns a new stack with inline storage.
+ *
+ * Detailed description see in stack.h
+ */
+stack_t *stack_create_inline(size_t size, size_t esize, size_t inline_size)
+{
+  UC_ASSERT(0 != esize);
+
+  if (!is_allocator_valid())
   {
-    container_delete(&stack->container);
-    mem_free(stack);
     return NULL;
   }
 
+  allocate_fn_t mem_allocate = get_allocator();
+
+  size_t inline_count = inline_size / esize;
+
+  stack_t *stack = (stack_t *)mem_allocate(META_OFFSET + sizeof(smeta_t) + inline_count * esize);
+  if (NULL == stack)
+  {
+    return NULL;
+  }
+
+  stack->meta = (void *)((uint8_t *)stack + META_OFFSET);
+  stack->iface = &stack_iface;
+
   smeta_t *meta = (smeta_t *)stack->meta;
   meta->capacity = size;
+  meta->esize = esize;
+  meta->count = 0;
+  meta->allocated = inline_count;
+  meta->inlined = inline_count;
+  meta->growth = STACK_GROWTH_GEOMETRIC;
+  meta->step = 2;
+  meta->shrink = 0;
+  meta->copy = ds_copy_select(esize);
+  meta->data = meta->buffer;
 
   return stack;
 }
@@ -90,13 +264,16 @@ void stack_delete(stack_t **stack)
 {
   UC_ASSERT(stack);
   UC_ASSERT(*stack);
-  UC_ASSERT((*stack)->container);
   UC_ASSERT((*stack)->meta);
 
   free_fn_t mem_free = get_free();
 
-  container_delete(&((*stack)->container));
-  mem_free(((*stack)->meta));
+  smeta_t *meta = (smeta_t *)(*stack)->meta;
+  if (is_spilled(meta))
+  {
+    mem_free(meta->data);
+  }
+
   mem_free(*stack);
   *stack = NULL;
 }
@@ -108,11 +285,45 @@ void stack_delete(stack_t **stack)
  */
 bool stack_push(stack_t *stack, const void *data)
 {
-  UC_ASSERT(stack);
-  UC_ASSERT(data);
-  UC_ASSERT(stack->container);
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_PARANOID(stack->meta);
 
-  return (!stack_full(stack)) ? container_push_back(stack->container, data) : false;
+  void *slot = stack_emplace(stack);
+  if (NULL == slot)
+  {
+    return false;
+  }
+
+  smeta_t *meta = (smeta_t *)stack->meta;
+  meta->copy(slot, data, meta->esize);
+
+  return true;
+}
+
+/**
+ * \brief Adds an uninitialized element to the stack and returns pointer to it.
+ *
+ * Detailed description see in stack.h
+ */
+void *stack_emplace(stack_t *stack)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
+
+  smeta_t *meta = (smeta_t *)stack->meta;
+
+  if (stack_full(stack))
+  {
+    return NULL;
+  }
+
+  if (meta->count == meta->allocated && !grow(meta))
+  {
+    return NULL;
+  }
+
+  return meta->data + meta->count++ * meta->esize;
 }
 
 /**
@@ -122,11 +333,23 @@ bool stack_push(stack_t *stack, const void *data)
  */
 bool stack_pop(stack_t *stack, void *data)
 {
-  UC_ASSERT(stack);
-  UC_ASSERT(data);
-  UC_ASSERT(stack->container);
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_PARANOID(stack->meta);
 
-  return container_pop_back(stack->container, data);
+  smeta_t *meta = (smeta_t *)stack->meta;
+
+  if (0 == meta->count)
+  {
+    return false;
+  }
+
+  meta->count--;
+  meta->copy(data, meta->data + meta->count * meta->esize, meta->esize);
+
+  autoshrink(meta);
+
+  return true;
 }
 
 /**
@@ -136,11 +359,35 @@ bool stack_pop(stack_t *stack, void *data)
  */
 bool stack_peek(const stack_t *stack, void *data)
 {
-  UC_ASSERT(stack);
-  UC_ASSERT(data);
-  UC_ASSERT(stack->container);
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_CHEAP(data);
+  DS_ASSERT_PARANOID(stack->meta);
+
+  const smeta_t *meta = (const smeta_t *)stack->meta;
 
-  return container_at(stack->container, data, container_size(stack->container) - 1);
+  if (0 == meta->count)
+  {
+    return false;
+  }
+
+  meta->copy(data, meta->data + (meta->count - 1) * meta->esize, meta->esize);
+
+  return true;
+}
+
+/**
+ * \brief Returns pointer to the top element of the stack.
+ *
+ * Detailed description see in stack.h
+ */
+void *stack_top_ptr(stack_t *stack)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
+
+  smeta_t *meta = (smeta_t *)stack->meta;
+
+  return (0 != meta->count) ? meta->data + (meta->count - 1) * meta->esize : NULL;
 }
 
 /**
@@ -150,10 +397,10 @@ bool stack_peek(const stack_t *stack, void *data)
  */
 size_t stack_size(const stack_t *stack)
 {
-  UC_ASSERT(stack);
-  UC_ASSERT(stack->container);
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
 
-  return container_size(stack->container);
+  return ((const smeta_t *)stack->meta)->count;
 }
 
 /**
@@ -163,8 +410,10 @@ size_t stack_size(const stack_t *stack)
  */
 bool stack_empty(const stack_t *stack)
 {
-  UC_ASSERT(stack);
-  return (container_size(stack->container) == 0);
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
+
+  return (((const smeta_t *)stack->meta)->count == 0);
 }
 
 /**
@@ -174,11 +423,11 @@ bool stack_empty(const stack_t *stack)
  */
 bool stack_full(const stack_t *stack)
 {
-  UC_ASSERT(stack);
-  UC_ASSERT(stack->container);
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
 
-  size_t size = ((smeta_t *)stack->meta)->capacity;
-  return (size != 0) ? container_size(stack->container) == size : false;
+  const smeta_t *meta = (const smeta_t *)stack->meta;
+  return (meta->capacity != 0) ? meta->count == meta->capacity : false;
 }
 
 /**
@@ -187,9 +436,91 @@ bool stack_full(const stack_t *stack)
  * Detailed description see in stack.h
  */
 bool stack_clear(stack_t *stack)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
+
+  smeta_t *meta = (smeta_t *)stack->meta;
+  meta->count = 0;
+
+  autoshrink(meta);
+
+  return true;
+}
+
+/**
+ * \brief Sets the growth policy of the stack.
+ *
+ * Detailed description see in stack.h
+ */
+bool stack_set_growth(stack_t *stack, stack_growth_t growth, size_t step)
+{
+  UC_ASSERT(stack);
+  UC_ASSERT(stack->meta);
+
+  if ((STACK_GROWTH_GEOMETRIC == growth && step < 2) || (STACK_GROWTH_LINEAR == growth && 0 == step))
+  {
+    return false;
+  }
+
+  smeta_t *meta = (smeta_t *)stack->meta;
+  meta->growth = growth;
+  meta->step = step;
+
+  return true;
+}
+
+/**
+ * \brief Enables automatic shrinking of the stack.
+ *
+ * Detailed description see in stack.h
+ */
+bool stack_set_autoshrink(stack_t *stack, size_t ratio)
 {
   UC_ASSERT(stack);
-  UC_ASSERT(stack->container);
+  UC_ASSERT(stack->meta);
+
+  if (0 != ratio && ratio < 3)
+  {
+    return false;
+  }
+
+  ((smeta_t *)stack->meta)->shrink = ratio;
+
+  return true;
+}
+
+/**
+ * \brief Preallocates the storage for the given number of elements.
+ *
+ * Detailed description see in stack.h
+ */
+bool stack_reserve(stack_t *stack, size_t count)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
+
+  smeta_t *meta = (smeta_t *)stack->meta;
+
+  if (0 != meta->capacity && count > meta->capacity)
+  {
+    count = meta->capacity;
+  }
+
+  return (count > meta->allocated) ? resize(meta, count) : true;
+}
+
+/**
+ * \brief Releases the unused part of the storage.
+ *
+ * Detailed description see in stack.h
+ */
+bool stack_shrink_to_fit(stack_t *stack)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_PARANOID(stack->meta);
+
+  smeta_t *meta = (smeta_t *)stack->meta;
 
-  return container_clear(stack->container);
+  return (is_spilled(meta) && meta->count < meta->allocated) ? resize(meta, meta->count) : true;
 }
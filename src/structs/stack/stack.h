@@ -13,11 +13,20 @@
 #include <stdint.h>
 #include <stdlib.h>
 
-#include "core/container.h"
 #include "structs/ds.h"
 //_____ C O N F I G S  ________________________________________________________
 //_____ D E F I N I T I O N S _________________________________________________
 typedef ds_t stack_t;
+
+/**
+ * \brief Policies of the growth of the stack storage when it is full.
+ */
+typedef enum
+{
+  STACK_GROWTH_GEOMETRIC = 0, /**< Multiply the storage size by the step (default, step is 2) */
+  STACK_GROWTH_LINEAR,        /**< Add the step elements to the storage size */
+  STACK_GROWTH_NONE,          /**< Never grow, storage has to be preallocated by `stack_reserve` */
+} stack_growth_t;
 //_____ M A C R O S ___________________________________________________________
 //_____ V A R I A B L E S _____________________________________________________
 //_____ P U B L I C  F U N C T I O N S_________________________________________
@@ -33,6 +42,23 @@ typedef ds_t stack_t;
  */
 stack_t *stack_create(size_t size, size_t esize);
 
+/**
+ * \brief Initializes and returns a new stack which keeps first elements in the inline buffer.
+ *
+ * The inline buffer is allocated in the same memory block as the stack itself, so a stack which never holds
+ * more than `inline_size / esize` elements does not use any other memory. On overflow the elements are moved
+ * to the heap.
+ *
+ * \param[in] size The size in elements of this stack or 0 if you won`t limit size of stack.
+ * \param[in] esize The size in bytes of the single element that this stack will store.
+ * \param[in] inline_size The size in bytes of the inline buffer.
+ *
+ * \note if the `size` argument equals 0 then the stack would be unlimited by size.
+ *
+ * \return Pointer to the newly created stack or NULL.
+ */
+stack_t *stack_create_inline(size_t size, size_t esize, size_t inline_size);
+
 /**
  * \brief Frees up the memory associated with the stack.
  *
@@ -67,6 +93,30 @@ bool stack_pop(stack_t *stack, void *data);
  */
 bool stack_peek(const stack_t *stack, void *data);
 
+/**
+ * \brief Adds a new element to the top of the stack without initializing it.
+ *
+ * The caller fills the element in place through the returned pointer, so no intermediate copy is needed.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \warning The returned pointer is valid only until the next call of the function which changes the stack:
+ *          `stack_push`, `stack_emplace`, `stack_pop`, `stack_clear`, `stack_reserve`, `stack_shrink_to_fit`
+ *          or `stack_delete`.
+ * \return Pointer to the new top element or NULL if the stack is full or memory can not be allocated.
+ */
+void *stack_emplace(stack_t *stack);
+
+/**
+ * \brief Returns pointer to the top element of the stack without copying it.
+ *
+ * The element can be read and modified in place through the returned pointer.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \warning The returned pointer has the same lifetime as the pointer returned by `stack_emplace`.
+ * \return Pointer to the top element or NULL if the stack is empty.
+ */
+void *stack_top_ptr(stack_t *stack);
+
 /**
  * \brief Returns the number of elements in the stack.
  *
@@ -98,3 +148,47 @@ bool stack_full(const stack_t *stack);
  * \return true if the operation was successful, false otherwise.
  */
 bool stack_clear(stack_t *stack);
+
+/**
+ * \brief Sets the policy of the growth of the stack storage.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \param[in] growth Growth policy.
+ * \param[in] step Growth factor for `STACK_GROWTH_GEOMETRIC` (at least 2) or number of elements for
+ *                 `STACK_GROWTH_LINEAR` (at least 1). Ignored for `STACK_GROWTH_NONE`.
+ * \return true if the operation was successful, false otherwise.
+ */
+bool stack_set_growth(stack_t *stack, stack_growth_t growth, size_t step);
+
+/**
+ * \brief Enables or disables automatic shrinking of the stack storage.
+ *
+ * When the number of elements drops to `1 / ratio` of the storage size after `stack_pop` or `stack_clear`
+ * the storage is reallocated to twice the number of elements. The gap between the shrink point and the next
+ * growth point prevents the stack from reallocating on every push/pop near the boundary.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \param[in] ratio Ratio of the storage size to the number of elements (at least 3) or 0 to disable.
+ * \note Automatic shrinking is never applied for `STACK_GROWTH_NONE` policy.
+ * \return true if the operation was successful, false otherwise.
+ */
+bool stack_set_autoshrink(stack_t *stack, size_t ratio);
+
+/**
+ * \brief Preallocates the storage of the stack for the given number of elements.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \param[in] count Number of elements. It is limited by the size of the stack if the stack is limited.
+ * \return true if the operation was successful, false otherwise.
+ */
+bool stack_reserve(stack_t *stack, size_t count);
+
+/**
+ * \brief Reduces the storage of the stack to the current number of elements.
+ *
+ * The elements are moved back to the inline buffer if they fit into it.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \return true if the operation was successful, false otherwise.
+ */
+bool stack_shrink_to_fit(stack_t *stack);
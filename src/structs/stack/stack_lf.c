@@ -0,0 +1,324 @@
+/**
+ * \file    stack_lf.c
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Unbounded lock-free stack (Treiber stack) with elimination backoff.
+ * \date    2026-10-18
+ */
+
+//_____ I N C L U D E S _______________________________________________________
+#include "stack_lf.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/uc_assert.h"
+#include "structs/ds_assert.h"
+#include "structs/ds_copy.h"
+#include "structs/ds_pool.h"
+#include "interface/allocator_if.h"
+//_____ C O N F I G S  ________________________________________________________
+//_____ D E F I N I T I O N S _________________________________________________
+/**
+ * \brief Node of the list.
+ */
+typedef struct
+{
+  atomic_uint next; /**< Index of the next node towards the bottom of the stack */
+  uint8_t data[];   /**< Element */
+} lf_node_t;
+
+struct StackLf_t
+{
+  atomic_uint_fast64_t top;  /**< Index of the top node in low half, tag in high half */
+  size_t esize;              /**< Size in bytes of the single element */
+  ds_copy_fn_t copy;         /**< Copy kernel for the size of element */
+  ds_pool_t *pool;           /**< Pool of the nodes */
+#if STACK_LF_ELIMINATION > 0
+  atomic_uint_fast64_t elimination[STACK_LF_ELIMINATION]; /**< Index of the offered node, tag in high half */
+#endif
+};
+//_____ M A C R O S ___________________________________________________________
+/** Packs the index and the tag incremented by one */
+#define TAGGED(old, index) ((((old) >> 32) + 1) << 32 | (uint32_t)(index))
+
+/** Extracts the index from the tagged value */
+#define INDEX(value) ((uint32_t)((value) & UINT32_MAX))
+//_____ V A R I A B L E S _____________________________________________________
+#if STACK_LF_ELIMINATION > 0
+/** State of the generator which spreads the threads over the elimination array */
+static _Thread_local uint32_t seed = 0;
+#endif
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+#if STACK_LF_ELIMINATION > 0
+/**
+ * \brief Returns the random slot of the elimination array.
+ */
+static atomic_uint_fast64_t *elimination_slot(stack_lf_t *stack)
+{
+  if (0 == seed)
+  {
+    seed = (uint32_t)(uintptr_t)&seed | 1U;
+  }
+
+  // xorshift32
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+
+  return &stack->elimination[seed % STACK_LF_ELIMINATION];
+}
+
+/**
+ * \brief Offers the node to the popping threads for a while.
+ *
+ * \return true if the node was taken by the popping thread.
+ */
+static bool eliminate_push(stack_lf_t *stack, uint32_t index)
+{
+  atomic_uint_fast64_t *slot = elimination_slot(stack);
+
+  uint_fast64_t value = atomic_load_explicit(slot, memory_order_relaxed);
+  if (DS_POOL_NIL != INDEX(value))
+  {
+    return false;
+  }
+
+  // Release publishes the element to the thread which takes the node
+  uint_fast64_t offer = TAGGED(value, index);
+  if (!atomic_compare_exchange_strong_explicit(slot, &value, offer, memory_order_release, memory_order_relaxed))
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < STACK_LF_ELIMINATION_SPINS; i++)
+  {
+    // Only the popping thread may change the offered value
+    if (offer != atomic_load_explicit(slot, memory_order_relaxed))
+    {
+      return true;
+    }
+  }
+
+  return !atomic_compare_exchange_strong_explicit(slot, &offer, TAGGED(offer, DS_POOL_NIL), memory_order_relaxed,
+                                                  memory_order_relaxed);
+}
+
+/**
+ * \brief Takes the node offered by the pushing thread if there is one.
+ *
+ * \return Index of the node or DS_POOL_NIL.
+ */
+static uint32_t eliminate_pop(stack_lf_t *stack)
+{
+  atomic_uint_fast64_t *slot = elimination_slot(stack);
+
+  uint_fast64_t value = atomic_load_explicit(slot, memory_order_relaxed);
+  uint32_t index = INDEX(value);
+  if (DS_POOL_NIL == index)
+  {
+    return DS_POOL_NIL;
+  }
+
+  if (!atomic_compare_exchange_strong_explicit(slot, &value, TAGGED(value, DS_POOL_NIL), memory_order_acquire,
+                                               memory_order_relaxed))
+  {
+    return DS_POOL_NIL;
+  }
+
+  return index;
+}
+#else
+static bool eliminate_push(stack_lf_t *stack, uint32_t index)
+{
+  (void)stack;
+  (void)index;
+  return false;
+}
+
+static uint32_t eliminate_pop(stack_lf_t *stack)
+{
+  (void)stack;
+  return DS_POOL_NIL;
+}
+#endif
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * Initializes and returns a new lock-free stack.
+ *
+ * Detailed description see in stack_lf.h
+ */
+stack_lf_t *stack_lf_create(size_t esize)
+{
+  UC_ASSERT(0 != esize);
+
+  if (!is_allocator_valid())
+  {
+    return NULL;
+  }
+
+  allocate_fn_t mem_allocate = get_allocator();
+  free_fn_t mem_free = get_free();
+
+  stack_lf_t *stack = (stack_lf_t *)mem_allocate(sizeof(stack_lf_t));
+  if (NULL == stack)
+  {
+    return NULL;
+  }
+
+  stack->pool = ds_pool_create(sizeof(lf_node_t) + esize, STACK_LF_SLAB);
+  if (NULL == stack->pool)
+  {
+    mem_free(stack);
+    return NULL;
+  }
+
+  atomic_init(&stack->top, DS_POOL_NIL);
+  stack->esize = esize;
+  stack->copy = ds_copy_select(esize);
+#if STACK_LF_ELIMINATION > 0
+  for (size_t i = 0; i < STACK_LF_ELIMINATION; i++)
+  {
+    atomic_init(&stack->elimination[i], DS_POOL_NIL);
+  }
+#endif
+
+  return stack;
+}
+
+/**
+ * Frees up the memory associated with the stack.
+ *
+ * Detailed description see in stack_lf.h
+ */
+void stack_lf_delete(stack_lf_t **stack)
+{
+  UC_ASSERT(stack);
+  UC_ASSERT(*stack);
+
+  free_fn_t mem_free = get_free();
+
+  // The nodes are freed together with the slabs of the pool
+  ds_pool_delete(&(*stack)->pool);
+  mem_free(*stack);
+  *stack = NULL;
+}
+
+/**
+ * Adds an element to the stack.
+ *
+ * Detailed description see in stack_lf.h
+ */
+bool stack_lf_push(stack_lf_t *stack, const void *data)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_CHEAP(data);
+
+  lf_node_t *node = (lf_node_t *)ds_pool_alloc(stack->pool);
+  if (NULL == node)
+  {
+    return false;
+  }
+
+  stack->copy(node->data, data, stack->esize);
+  uint32_t index = ds_pool_index(stack->pool, node);
+
+  uint_fast64_t top = atomic_load_explicit(&stack->top, memory_order_relaxed);
+  for (;;)
+  {
+    atomic_store_explicit(&node->next, INDEX(top), memory_order_relaxed);
+    if (atomic_compare_exchange_weak_explicit(&stack->top, &top, TAGGED(top, index), memory_order_release,
+                                              memory_order_relaxed))
+    {
+      return true;
+    }
+
+    if (eliminate_push(stack, index))
+    {
+      return true;
+    }
+    top = atomic_load_explicit(&stack->top, memory_order_relaxed);
+  }
+}
+
+/**
+ * Removes an element from the stack and returns it.
+ *
+ * Detailed description see in stack_lf.h
+ */
+bool stack_lf_pop(stack_lf_t *stack, void *data)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_CHEAP(data);
+
+  uint_fast64_t top = atomic_load_explicit(&stack->top, memory_order_acquire);
+  uint32_t index;
+
+  for (;;)
+  {
+    index = INDEX(top);
+    if (DS_POOL_NIL == index)
+    {
+      return false;
+    }
+
+    // The node may be popped and reused by another thread meanwhile, but its memory stays valid and the tag
+    // of the top detects it
+    lf_node_t *node = (lf_node_t *)ds_pool_node(stack->pool, index);
+    uint32_t next = atomic_load_explicit(&node->next, memory_order_relaxed);
+    if (atomic_compare_exchange_weak_explicit(&stack->top, &top, TAGGED(top, next), memory_order_acquire,
+                                              memory_order_acquire))
+    {
+      break;
+    }
+
+    index = eliminate_pop(stack);
+    if (DS_POOL_NIL != index)
+    {
+      break;
+    }
+    top = atomic_load_explicit(&stack->top, memory_order_acquire);
+  }
+
+  lf_node_t *node = (lf_node_t *)ds_pool_node(stack->pool, index);
+  stack->copy(data, node->data, stack->esize);
+  ds_pool_free(stack->pool, node);
+
+  return true;
+}
+
+/**
+ * Retrieves the element from the top of the stack without removing it.
+ *
+ * Detailed description see in stack_lf.h
+ */
+bool stack_lf_peek(const stack_lf_t *stack, void *data)
+{
+  DS_ASSERT_CHEAP(stack);
+  DS_ASSERT_CHEAP(data);
+
+  uint_fast64_t top = atomic_load_explicit(&stack->top, memory_order_acquire);
+  uint32_t index = INDEX(top);
+  if (DS_POOL_NIL == index)
+  {
+    return false;
+  }
+
+  const lf_node_t *node = (const lf_node_t *)ds_pool_node(stack->pool, index);
+  stack->copy(data, node->data, stack->esize);
+
+  return true;
+}
+
+/**
+ * Checks if the stack is empty.
+ *
+ * Detailed description see in stack_lf.h
+ */
+bool stack_lf_empty(const stack_lf_t *stack)
+{
+  DS_ASSERT_CHEAP(stack);
+
+  return DS_POOL_NIL == INDEX(atomic_load_explicit(&stack->top, memory_order_relaxed));
+}
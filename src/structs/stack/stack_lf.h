@@ -0,0 +1,98 @@
+/**
+ * \file    stack_lf.h
+ * \author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * \brief   Unbounded lock-free stack (Treiber stack) with elimination backoff.
+ * \date    2026-10-18
+ *
+ * The stack is the list of nodes linked from the top. The nodes are taken from the lock-free pool (see ds_pool.h),
+ * which never returns them to the allocator, so the popping thread may read the `next` link of the node which was
+ * popped and reused by another thread meanwhile. The top is the 32-bit index of the node tagged by the 32-bit
+ * counter of changes, so such stale top fails the single-width CAS (ABA protection without double-width CAS).
+ *
+ * When the CAS of the top fails because of the contention, the thread visits the random slot of the elimination
+ * array: the pushing thread offers its node there for a while and the popping thread takes the offered node, so
+ * the pair completes without touching the top at all.
+ *
+ * The stack doesn't support `ds_t` interface: its elements are linked from the top, but the interface walks the
+ * stacks from the bottom.
+ */
+
+#pragma once
+
+//_____ I N C L U D E S _______________________________________________________
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+//_____ C O N F I G S  ________________________________________________________
+/** Number of nodes allocated at once when the pool of the stack is exhausted */
+#ifndef STACK_LF_SLAB
+  #define STACK_LF_SLAB 256U
+#endif
+
+/** Number of slots of the elimination array, 0 disables the elimination */
+#ifndef STACK_LF_ELIMINATION
+  #define STACK_LF_ELIMINATION 8U
+#endif
+
+/** Number of polls of the slot by the pushing thread before it withdraws its offer */
+#ifndef STACK_LF_ELIMINATION_SPINS
+  #define STACK_LF_ELIMINATION_SPINS 64U
+#endif
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct StackLf_t stack_lf_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * \brief Initializes and returns a new unbounded lock-free stack.
+ *
+ * \param[in] esize The size in bytes of the single element that this stack will store.
+ *
+ * \return Pointer to the newly created stack or NULL.
+ */
+stack_lf_t *stack_lf_create(size_t esize);
+
+/**
+ * \brief Frees up the memory associated with the stack. There must be no other threads using the stack.
+ *
+ * \param[in] stack Double pointer to the stack to be deleted.
+ */
+void stack_lf_delete(stack_lf_t **stack);
+
+/**
+ * \brief Adds an element to the stack. May be called by any number of threads concurrently.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \param[in] data Pointer to the variable to be pushed.
+ * \return true if the operation was successful, false if there is no memory for the node.
+ */
+bool stack_lf_push(stack_lf_t *stack, const void *data);
+
+/**
+ * \brief Removes an element from the stack and returns it. May be called by any number of threads concurrently.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \param[out] data Pointer to a variable where the popped element will be stored.
+ * \return true if the operation was successful, false if the stack is empty.
+ */
+bool stack_lf_pop(stack_lf_t *stack, void *data);
+
+/**
+ * \brief Retrieves the element from the top of the stack without removing it.
+ *
+ * May run concurrently with `stack_lf_push`, but not with `stack_lf_pop`: the node of the top element may be
+ * reused by another element while it is being copied.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \param[out] data Pointer to a variable where the peeked element will be stored.
+ * \return true if the operation was successful, false if the stack is empty.
+ */
+bool stack_lf_peek(const stack_lf_t *stack, void *data);
+
+/**
+ * \brief Checks if the stack is empty. The result may be outdated at once if other threads use the stack.
+ *
+ * \param[in] stack Pointer to the stack.
+ * \return true if the stack is empty, false otherwise.
+ */
+bool stack_lf_empty(const stack_lf_t *stack);
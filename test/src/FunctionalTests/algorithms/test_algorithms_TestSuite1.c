@@ -0,0 +1,203 @@
+/**
+ * @file    test_algorithms_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for generic algorithms over data structures.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "algorithms/algorithms.h"
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/queue/queue.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_DS_LEN 100
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ring_buffer_t* rb = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static bool is_even(const void* element, void* ctx)
+{
+  (void)ctx;
+  return (*(const int32_t*)element % 2) == 0;
+}
+
+static int compare_u32(const void* a, const void* b)
+{
+  uint32_t x = *(const uint32_t*)a;
+  uint32_t y = *(const uint32_t*)b;
+  return (x > y) - (x < y);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Creates the ring buffer with elements -50..49 wrapped around the end of the storage.
+ */
+void setUp(void)
+{
+  int32_t data = 0;
+
+  rb = rb_create(TEST_DS_LEN + 1, sizeof(int32_t));
+
+  for (size_t i = 0; i < TEST_DS_LEN / 2; i++)
+  {
+    rb_add(rb, &data);
+  }
+  rb_advance_tail(rb, TEST_DS_LEN / 2);
+
+  for (int32_t i = -TEST_DS_LEN / 2; i < TEST_DS_LEN / 2; i++)
+  {
+    rb_add(rb, &i);
+  }
+}
+
+void tearDown(void)
+{
+  rb_delete(&rb);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Algorithms Tests");
+}
+
+/**
+ * @brief Tests sum and min/max over the wrapped ring buffer.
+ */
+void test_TestCase_0(void)
+{
+  int64_t sum = 0;
+  int32_t min = 0;
+  int32_t max = 0;
+
+  TEST_MESSAGE("[ALG_TEST]: sum/min/max");
+
+  TEST_ASSERT_TRUE(alg_sum(rb, ALG_TYPE_I32, &sum));
+  TEST_ASSERT_EQUAL_INT64(-TEST_DS_LEN / 2, sum);
+  TEST_ASSERT_TRUE(alg_min(rb, ALG_TYPE_I32, &min));
+  TEST_ASSERT_EQUAL_INT32(-TEST_DS_LEN / 2, min);
+  TEST_ASSERT_TRUE(alg_max(rb, ALG_TYPE_I32, &max));
+  TEST_ASSERT_EQUAL_INT32(TEST_DS_LEN / 2 - 1, max);
+
+  TEST_ASSERT_FALSE(alg_sum(rb, ALG_TYPE_I64, &sum));
+}
+
+/**
+ * @brief Tests count_if and find over the wrapped ring buffer.
+ */
+void test_TestCase_1(void)
+{
+  int32_t value = 42;
+  int32_t missing = TEST_DS_LEN;
+
+  TEST_MESSAGE("[ALG_TEST]: count_if/find");
+
+  TEST_ASSERT_EQUAL_UINT32(TEST_DS_LEN / 2, alg_count_if(rb, is_even, NULL));
+
+  int32_t* element = (int32_t*)alg_find(rb, &value);
+  TEST_ASSERT_NOT_NULL(element);
+  TEST_ASSERT_EQUAL_INT32(value, *element);
+  TEST_ASSERT_NULL(alg_find(rb, &missing));
+}
+
+/**
+ * @brief Tests fill and copy over the wrapped ring buffer.
+ */
+void test_TestCase_2(void)
+{
+  int32_t value = 7;
+  int32_t output[TEST_DS_LEN] = {0};
+
+  TEST_MESSAGE("[ALG_TEST]: fill/copy");
+
+  TEST_ASSERT_EQUAL_UINT32(TEST_DS_LEN, alg_copy(rb, output, TEST_DS_LEN));
+  for (int32_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    TEST_ASSERT_EQUAL_INT32(i - TEST_DS_LEN / 2, output[i]);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(TEST_DS_LEN, alg_fill(rb, &value));
+  TEST_ASSERT_EQUAL_UINT32(TEST_DS_LEN / 2, alg_copy(rb, output, TEST_DS_LEN / 2));
+  for (int32_t i = 0; i < TEST_DS_LEN / 2; i++)
+  {
+    TEST_ASSERT_EQUAL_INT32(value, output[i]);
+  }
+}
+
+/**
+ * @brief Tests the algorithms over the list based queue and the stack.
+ */
+void test_TestCase_3(void)
+{
+  double sum = 0;
+  float min = 0;
+  uint16_t value = 3;
+
+  TEST_MESSAGE("[ALG_TEST]: queue and stack");
+
+  queue_t* queue = queue_create(0, sizeof(float));
+  stack_t* stack = stack_create(0, sizeof(uint16_t));
+
+  TEST_ASSERT_FALSE(alg_min(queue, ALG_TYPE_FLOAT, &min));
+
+  for (uint16_t i = 1; i <= TEST_DS_LEN; i++)
+  {
+    float f = (float)i;
+    queue_add(queue, &f);
+    stack_push(stack, &i);
+  }
+
+  TEST_ASSERT_TRUE(alg_sum(queue, ALG_TYPE_FLOAT, &sum));
+  TEST_ASSERT_TRUE(sum == TEST_DS_LEN * (TEST_DS_LEN + 1) / 2);
+  TEST_ASSERT_TRUE(alg_min(queue, ALG_TYPE_FLOAT, &min));
+  TEST_ASSERT_TRUE(min == 1.0f);
+
+  TEST_ASSERT_EQUAL_PTR(alg_find(stack, &value), (uint16_t*)stack_top_ptr(stack) - (TEST_DS_LEN - value));
+
+  queue_delete(&queue);
+  stack_delete(&stack);
+}
+
+/**
+ * @brief Tests that the algorithms walk the stack in the storage order, from the bottom to the top.
+ */
+void test_TestCase_4(void)
+{
+  uint32_t output[4] = {0};
+  uint32_t value = 2;
+
+  TEST_MESSAGE("[ALG_TEST]: stack order");
+
+  stack_t* stack = stack_create(0, sizeof(uint32_t));
+  for (uint32_t i = 1; i <= 3; i++)
+  {
+    stack_push(stack, &i);
+  }
+  stack_push(stack, &value);
+
+  TEST_ASSERT_EQUAL_UINT32(4, alg_copy(stack, output, 4));
+  TEST_ASSERT_EQUAL_UINT32(1, output[0]);
+  TEST_ASSERT_EQUAL_UINT32(2, output[1]);
+  TEST_ASSERT_EQUAL_UINT32(3, output[2]);
+  TEST_ASSERT_EQUAL_UINT32(2, output[3]);
+
+  // The bottom one of two equal elements is found, not the top
+  TEST_ASSERT_EQUAL_PTR((uint32_t*)stack_top_ptr(stack) - 2, alg_find(stack, &value));
+
+  TEST_ASSERT_TRUE(alg_sort(stack, compare_u32, 1));
+  TEST_ASSERT_TRUE(stack_pop(stack, &value));
+  TEST_ASSERT_EQUAL_UINT32(3, value);
+  TEST_ASSERT_TRUE(stack_pop(stack, &value));
+  TEST_ASSERT_EQUAL_UINT32(2, value);
+
+  stack_delete(&stack);
+}
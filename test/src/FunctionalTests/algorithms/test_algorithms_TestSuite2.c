@@ -0,0 +1,228 @@
+/**
+ * @file    test_algorithms_TestSuite2.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for sorting and searching algorithms over data structures.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "algorithms/algorithms.h"
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/queue/queue.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_DS_LEN 100
+#define TEST_BIG_LEN 200000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint16_t payload;
+  int64_t key;
+} record_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static uint32_t seed = 1;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static uint32_t next_random(void)
+{
+  seed = seed * 1103515245U + 12345U;
+  return seed >> 1;
+}
+
+static int compare_i32(const void* a, const void* b)
+{
+  int32_t x = *(const int32_t*)a;
+  int32_t y = *(const int32_t*)b;
+  return (x > y) - (x < y);
+}
+
+static int compare_record(const void* a, const void* b)
+{
+  int64_t x = ((const record_t*)a)->key;
+  int64_t y = ((const record_t*)b)->key;
+  return (x > y) - (x < y);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  seed = 1;
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Algorithms Sort Tests");
+}
+
+/**
+ * @brief Tests the parallel sort of the big stack.
+ */
+void test_TestCase_0(void)
+{
+  TEST_MESSAGE("[ALG_TEST]: parallel sort");
+
+  stack_t* stack = stack_create(0, sizeof(int32_t));
+  for (size_t i = 0; i < TEST_BIG_LEN; i++)
+  {
+    int32_t value = (int32_t)(next_random() % 1000) - 500;
+    stack_push(stack, &value);
+  }
+
+  TEST_ASSERT_TRUE(alg_sort(stack, compare_i32, 3));
+
+  int32_t prev = 0;
+  TEST_ASSERT_TRUE(stack_pop(stack, &prev));
+  for (size_t i = 1; i < TEST_BIG_LEN; i++)
+  {
+    int32_t value = 0;
+    TEST_ASSERT_TRUE(stack_pop(stack, &value));
+    TEST_ASSERT_TRUE(value <= prev);
+    prev = value;
+  }
+
+  stack_delete(&stack);
+}
+
+/**
+ * @brief Tests the sort and the radix sort of the wrapped ring buffer and the queue.
+ */
+void test_TestCase_1(void)
+{
+  int32_t data = 0;
+  float f = 0;
+
+  TEST_MESSAGE("[ALG_TEST]: sort of fragmented storage");
+
+  ring_buffer_t* rb = rb_create(TEST_DS_LEN + 1, sizeof(int32_t));
+  queue_t* queue = queue_create(0, sizeof(float));
+
+  for (size_t i = 0; i < TEST_DS_LEN / 2; i++)
+  {
+    rb_add(rb, &data);
+  }
+  rb_advance_tail(rb, TEST_DS_LEN / 2);
+
+  for (int32_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    data = (i % 2) ? i : -i;
+    rb_add(rb, &data);
+    f = (float)data / 4;
+    queue_add(queue, &f);
+  }
+
+  TEST_ASSERT_TRUE(alg_sort(rb, compare_i32, 0));
+  TEST_ASSERT_TRUE(alg_radix_sort(queue, ALG_TYPE_FLOAT, 0));
+
+  int32_t prev = INT32_MIN;
+  float prev_f = -1e9f;
+  for (size_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_TRUE(data >= prev);
+    prev = data;
+
+    TEST_ASSERT_TRUE(queue_get(queue, &f));
+    TEST_ASSERT_TRUE(f >= prev_f);
+    prev_f = f;
+  }
+
+  rb_delete(&rb);
+  queue_delete(&queue);
+}
+
+/**
+ * @brief Tests the radix sort by the key inside of the record: it has to be stable.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[ALG_TEST]: radix sort of records");
+
+  stack_t* stack = stack_create(0, sizeof(record_t));
+  for (uint16_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    record_t record = {.payload = i, .key = ((int64_t)(next_random() % 8) - 4) * 0x100000000LL};
+    stack_push(stack, &record);
+  }
+
+  TEST_ASSERT_TRUE(alg_radix_sort(stack, ALG_TYPE_I64, offsetof(record_t, key)));
+
+  record_t* top = (record_t*)stack_top_ptr(stack);
+  record_t* bottom = top - (TEST_DS_LEN - 1);
+  for (record_t* r = bottom + 1; r <= top; r++)
+  {
+    TEST_ASSERT_TRUE(r[-1].key <= r->key);
+    if (r[-1].key == r->key)
+    {
+      TEST_ASSERT_TRUE(r[-1].payload < r->payload);
+    }
+  }
+
+  record_t key = {.key = 0};
+  record_t* found = (record_t*)alg_lower_bound(stack, &key, compare_record);
+  TEST_ASSERT_NOT_NULL(found);
+  TEST_ASSERT_TRUE(found->key >= 0);
+  TEST_ASSERT_TRUE(found == bottom || found[-1].key < 0);
+
+  stack_delete(&stack);
+}
+
+/**
+ * @brief Tests the binary search and the Eytzinger search against each other.
+ */
+void test_TestCase_3(void)
+{
+  int32_t data = 0;
+
+  TEST_MESSAGE("[ALG_TEST]: lower bound and Eytzinger search");
+
+  ring_buffer_t* rb = rb_create(TEST_DS_LEN + 1, sizeof(int32_t));
+  for (size_t i = 0; i < TEST_DS_LEN / 3; i++)
+  {
+    rb_add(rb, &data);
+  }
+  rb_advance_tail(rb, TEST_DS_LEN / 3);
+
+  for (int32_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    data = 2 * i;
+    rb_add(rb, &data);
+  }
+
+  alg_eytzinger_t* tree = alg_eytzinger_create(rb);
+  TEST_ASSERT_NOT_NULL(tree);
+
+  for (int32_t key = -1; key <= 2 * TEST_DS_LEN; key++)
+  {
+    int32_t* bound = (int32_t*)alg_lower_bound(rb, &key, compare_i32);
+    const int32_t* node = (const int32_t*)alg_eytzinger_search(tree, &key, compare_i32);
+
+    if (key > 2 * (TEST_DS_LEN - 1))
+    {
+      TEST_ASSERT_NULL(bound);
+      TEST_ASSERT_NULL(node);
+      continue;
+    }
+
+    int32_t expected = (key < 0) ? 0 : key + (key % 2);
+    TEST_ASSERT_NOT_NULL(bound);
+    TEST_ASSERT_NOT_NULL(node);
+    TEST_ASSERT_EQUAL_INT32(expected, *bound);
+    TEST_ASSERT_EQUAL_INT32(expected, *node);
+  }
+
+  alg_eytzinger_delete(&tree);
+  TEST_ASSERT_NULL(tree);
+  rb_delete(&rb);
+}
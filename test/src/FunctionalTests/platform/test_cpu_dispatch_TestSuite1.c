@@ -0,0 +1,94 @@
+/**
+ * @file    test_cpu_dispatch_TestSuite1.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for the runtime CPU features dispatch.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algorithms/algorithms.h"
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "platform/cpu_dispatch.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_DS_LEN 100
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+/**
+ * @brief Caps the level before the features are detected on the first call.
+ */
+void setUp(void)
+{
+  setenv(CPU_DISPATCH_ENV, "sse2", 1);
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("CPU Dispatch Tests");
+}
+
+/**
+ * @brief Tests that the environment variable caps the features.
+ */
+void test_TestCase_0(void)
+{
+  TEST_MESSAGE("[CPU_TEST]: override");
+
+  TEST_ASSERT_EQUAL_UINT32(0, cpu_features() & ~(uint32_t)CPU_FEATURE_SSE2);
+  TEST_ASSERT_FALSE(cpu_has(CPU_FEATURE_AVX2));
+  TEST_ASSERT_FALSE(cpu_has(CPU_FEATURE_AVX512F));
+  TEST_ASSERT_TRUE(cpu_level() <= CPU_LEVEL_SSE2);
+  TEST_ASSERT_EQUAL(cpu_has(CPU_FEATURE_SSE2), cpu_level() == CPU_LEVEL_SSE2);
+}
+
+/**
+ * @brief Tests the names of the levels.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[CPU_TEST]: level names");
+
+  TEST_ASSERT_EQUAL_STRING("scalar", cpu_level_name(CPU_LEVEL_SCALAR));
+  TEST_ASSERT_EQUAL_STRING("sse4.2", cpu_level_name(CPU_LEVEL_SSE42));
+  TEST_ASSERT_EQUAL_STRING("avx512", cpu_level_name(CPU_LEVEL_AVX512));
+}
+
+/**
+ * @brief Tests that the algorithms work with the capped kernels.
+ */
+void test_TestCase_2(void)
+{
+  int64_t sum = 0;
+  uint32_t value = 42;
+
+  TEST_MESSAGE("[CPU_TEST]: algorithms with capped kernels");
+
+  stack_t* stack = stack_create(0, sizeof(uint32_t));
+  for (uint32_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    stack_push(stack, &i);
+  }
+
+  TEST_ASSERT_TRUE(alg_sum(stack, ALG_TYPE_I32, &sum));
+  TEST_ASSERT_EQUAL_INT64(TEST_DS_LEN * (TEST_DS_LEN - 1) / 2, sum);
+  TEST_ASSERT_EQUAL_PTR((uint32_t*)stack_top_ptr(stack) - (TEST_DS_LEN - 1 - value), alg_find(stack, &value));
+
+  stack_delete(&stack);
+}
@@ -0,0 +1,140 @@
+/**
+ * @file    test_mem_pages_TestSuite1.c
+ * @author  Aliaksander Kavalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for allocation of large buffers with huge pages and NUMA binding.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "platform/mem_pages.h"
+#include "structs/rb/ring_buffer.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define BUFFER_SIZE (3U * 1024U * 1024U + 100U)
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Allocates the buffer with the options and checks that it is zeroed and writable.
+ */
+static void check_alloc(const mem_pages_opts_t* opts, size_t align)
+{
+  size_t mapped = 0;
+
+  uint8_t* buffer = (uint8_t*)mem_pages_alloc(BUFFER_SIZE, opts, &mapped);
+  TEST_ASSERT_NOT_NULL(buffer);
+  TEST_ASSERT_TRUE(mapped >= BUFFER_SIZE);
+  TEST_ASSERT_EQUAL_UINT32(0, mapped % align);
+  TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)buffer % align);
+
+  TEST_ASSERT_EQUAL_HEX8(0, buffer[0]);
+  TEST_ASSERT_EQUAL_HEX8(0, buffer[BUFFER_SIZE - 1]);
+  memset(buffer, 0x5A, BUFFER_SIZE);
+  TEST_ASSERT_EQUAL_HEX8(0x5A, buffer[mapped / 2]);
+
+  mem_pages_free(buffer, mapped);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Memory Pages Tests");
+}
+
+/**
+ * @brief Tests the buffers of all kinds of pages.
+ */
+void test_TestCase_0(void)
+{
+  mem_pages_opts_t opts = {.pages = MEM_PAGES_DEFAULT, .node = -1, .populate = false};
+
+  TEST_MESSAGE("[MEM_TEST]: kinds of pages");
+
+  check_alloc(NULL, 4096);
+  check_alloc(&opts, 4096);
+
+  opts.pages = MEM_PAGES_HUGE_ADVISE;
+  check_alloc(&opts, MEM_HUGE_PAGE_SIZE);
+
+  // Falls back to the transparent huge pages if the pool of huge pages is empty
+  opts.pages = MEM_PAGES_HUGE;
+  opts.populate = true;
+  check_alloc(&opts, MEM_HUGE_PAGE_SIZE);
+}
+
+/**
+ * @brief Tests the binding to the NUMA node and the first touch which keeps the content.
+ */
+void test_TestCase_1(void)
+{
+  mem_pages_opts_t opts = {.pages = MEM_PAGES_DEFAULT, .node = 0, .populate = false};
+  size_t mapped = 0;
+
+  TEST_MESSAGE("[MEM_TEST]: NUMA node");
+
+  if (mem_numa_nodes() > 0)
+  {
+    check_alloc(&opts, 4096);
+
+    opts.node = mem_numa_nodes();
+    TEST_ASSERT_NULL(mem_pages_alloc(BUFFER_SIZE, &opts, &mapped));
+  }
+
+  uint8_t buffer[10000];
+  for (size_t i = 0; i < sizeof(buffer); i++)
+  {
+    buffer[i] = (uint8_t)i;
+  }
+  mem_pages_touch(buffer, sizeof(buffer));
+  for (size_t i = 0; i < sizeof(buffer); i++)
+  {
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)i, buffer[i]);
+  }
+}
+
+/**
+ * @brief Tests the ring buffer whose storage is backed by the huge pages.
+ */
+void test_TestCase_2(void)
+{
+  mem_pages_opts_t opts = {.pages = MEM_PAGES_HUGE_ADVISE, .node = -1, .populate = false};
+  uint64_t data = 0;
+
+  TEST_MESSAGE("[MEM_TEST]: ring buffer");
+
+  ring_buffer_t* rb = rb_create_pages(1U << 20, sizeof(uint64_t), &opts);
+  TEST_ASSERT_NOT_NULL(rb);
+
+  rb_prefault(rb);
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+
+  for (uint64_t i = 0; i < 3000; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(rb, &i));
+  }
+  rb_prefault(rb);
+  for (uint64_t i = 0; i < 3000; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_EQUAL_UINT32(i, data);
+  }
+
+  rb_delete(&rb);
+}
@@ -0,0 +1,210 @@
+/**
+ * @file    test_queue_TestSuite4.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for lock-free Queue with multiple producers and single consumer.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_cursor.h"
+#include "structs/ds_fc.h"
+#include "structs/ds_pool.h"
+#include "structs/ds_sync.h"
+#include "structs/queue/queue_mpsc.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define PRODUCERS 4
+#define ELEMENTS 50000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t producer;
+  uint32_t seq;
+} message_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static queue_mpsc_t* queue = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void* producer(void* arg)
+{
+  message_t message = {.producer = (uint32_t)(uintptr_t)arg, .seq = 0};
+
+  for (uint32_t i = 0; i < ELEMENTS; i++)
+  {
+    message.seq = i;
+    TEST_ASSERT_TRUE(queue_mpsc_add(queue, &message));
+  }
+
+  return NULL;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  queue = queue_mpsc_create(sizeof(message_t));
+}
+
+void tearDown(void)
+{
+  queue_mpsc_delete(&queue);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Queue MPSC Tests");
+}
+
+/**
+ * @brief Tests the order of elements in the single thread and the cursor.
+ */
+void test_TestCase_0(void)
+{
+  message_t message = {0};
+  ds_cursor_t cursor;
+
+  TEST_MESSAGE("[QUEUE_TEST]: mpsc order");
+
+  TEST_ASSERT_NOT_NULL(queue);
+  TEST_ASSERT_TRUE(queue_mpsc_empty(queue));
+  TEST_ASSERT_FALSE(queue_mpsc_get(queue, &message));
+  TEST_ASSERT_FALSE(queue_mpsc_peek(queue, &message));
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    message.seq = i;
+    TEST_ASSERT_TRUE(queue_mpsc_add(queue, &message));
+  }
+
+  TEST_ASSERT_TRUE(queue_mpsc_peek(queue, &message));
+  TEST_ASSERT_EQUAL_UINT32(0, message.seq);
+
+  uint32_t expected = 0;
+  message_t* element = NULL;
+  ds_cursor_init(&cursor, queue);
+  while (NULL != (element = ds_cursor_next(&cursor)))
+  {
+    TEST_ASSERT_EQUAL_UINT32(expected++, element->seq);
+  }
+  TEST_ASSERT_EQUAL_UINT32(10, expected);
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(queue_mpsc_get(queue, &message));
+    TEST_ASSERT_EQUAL_UINT32(i, message.seq);
+  }
+  TEST_ASSERT_TRUE(queue_mpsc_empty(queue));
+}
+
+/**
+ * @brief Tests the long steady flow of elements through the recycled nodes.
+ */
+void test_TestCase_1(void)
+{
+  message_t message = {0};
+
+  TEST_MESSAGE("[QUEUE_TEST]: mpsc recycling");
+
+  for (uint32_t i = 0; i < 100000; i++)
+  {
+    message.seq = i;
+    TEST_ASSERT_TRUE(queue_mpsc_add(queue, &message));
+    TEST_ASSERT_TRUE(queue_mpsc_add(queue, &message));
+    TEST_ASSERT_TRUE(queue_mpsc_get(queue, &message));
+    TEST_ASSERT_TRUE(queue_mpsc_get(queue, &message));
+    TEST_ASSERT_EQUAL_UINT32(i, message.seq);
+  }
+
+  TEST_ASSERT_TRUE(queue_mpsc_empty(queue));
+}
+
+/**
+ * @brief Tests that the elements of every producer are retrieved once and in their order.
+ */
+void test_TestCase_2(void)
+{
+  pthread_t threads[PRODUCERS];
+  uint32_t next[PRODUCERS] = {0};
+  message_t message = {0};
+
+  TEST_MESSAGE("[QUEUE_TEST]: mpsc threads");
+
+  for (uint32_t i = 0; i < PRODUCERS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, producer, (void*)(uintptr_t)i));
+  }
+
+  for (size_t received = 0; received < PRODUCERS * ELEMENTS;)
+  {
+    if (queue_mpsc_get(queue, &message))
+    {
+      TEST_ASSERT_TRUE(message.producer < PRODUCERS);
+      TEST_ASSERT_EQUAL_UINT32(next[message.producer], message.seq);
+      next[message.producer]++;
+      received++;
+    }
+  }
+
+  for (uint32_t i = 0; i < PRODUCERS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+    TEST_ASSERT_EQUAL_UINT32(ELEMENTS, next[i]);
+  }
+  TEST_ASSERT_TRUE(queue_mpsc_empty(queue));
+}
+
+/**
+ * @brief Tests the pool of nodes directly.
+ */
+void test_TestCase_3(void)
+{
+  void* nodes[600];
+
+  TEST_MESSAGE("[QUEUE_TEST]: pool");
+
+  ds_pool_t* pool = ds_pool_create(24, 256);
+  TEST_ASSERT_NOT_NULL(pool);
+  TEST_ASSERT_EQUAL_UINT32(0, ds_pool_capacity(pool));
+
+  for (size_t i = 0; i < 600; i++)
+  {
+    nodes[i] = ds_pool_alloc(pool);
+    TEST_ASSERT_NOT_NULL(nodes[i]);
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)nodes[i] % 8);
+    memset(nodes[i], (int)i, 24);
+  }
+  TEST_ASSERT_EQUAL_UINT32(768, ds_pool_capacity(pool));
+
+  for (size_t i = 0; i < 600; i++)
+  {
+    ds_pool_free(pool, nodes[i]);
+  }
+  for (size_t i = 0; i < 600; i++)
+  {
+    TEST_ASSERT_NOT_NULL(ds_pool_alloc(pool));
+  }
+  TEST_ASSERT_EQUAL_UINT32(768, ds_pool_capacity(pool));
+
+  ds_pool_delete(&pool);
+  TEST_ASSERT_NULL(pool);
+}
+
+/**
+ * @brief Tests that the wrappers calling the functions of the ordinary queue refuse MPSC queue.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[QUEUE_TEST]: wrappers");
+
+  TEST_ASSERT_EQUAL_INT(DS_KIND_QUEUE_MPSC, queue->iface->kind);
+  TEST_ASSERT_NULL(ds_sync_create(queue, DS_LOCK_MUTEX));
+  TEST_ASSERT_NULL(ds_fc_create(queue));
+}
@@ -0,0 +1,195 @@
+/**
+ * @file    test_queue_TestSuite5.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for sharded Queue with stealing of elements.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/queue/queue_sharded.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define SHARDS    4
+#define ELEMENTS  20000
+#define BATCH     16
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t producer;
+  uint32_t seq;
+} message_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static queue_sharded_t* queue = NULL;
+static uint8_t seen[SHARDS * ELEMENTS];
+static atomic_size_t received = 0;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void* producer(void* arg)
+{
+  message_t message = {.producer = (uint32_t)(uintptr_t)arg, .seq = 0};
+
+  for (uint32_t i = 0; i < ELEMENTS; i++)
+  {
+    message.seq = i;
+    TEST_ASSERT_TRUE(queue_sharded_add(queue, message.producer, &message));
+  }
+
+  return NULL;
+}
+
+static void* consumer(void* arg)
+{
+  size_t shard = (size_t)(uintptr_t)arg;
+  int64_t last[SHARDS];
+  message_t batch[BATCH];
+
+  for (size_t i = 0; i < SHARDS; i++)
+  {
+    last[i] = -1;
+  }
+
+  while (atomic_load(&received) < SHARDS * ELEMENTS)
+  {
+    size_t count = (0 == shard % 2) ? queue_sharded_get_batch(queue, shard, batch, BATCH)
+                                    : (size_t)queue_sharded_get(queue, shard, batch);
+
+    for (size_t i = 0; i < count; i++)
+    {
+      // Every consumer sees the elements of one producer in the order of adding
+      TEST_ASSERT_TRUE(batch[i].producer < SHARDS);
+      TEST_ASSERT_TRUE((int64_t)batch[i].seq > last[batch[i].producer]);
+      last[batch[i].producer] = batch[i].seq;
+      __atomic_fetch_add(&seen[batch[i].producer * ELEMENTS + batch[i].seq], 1, __ATOMIC_RELAXED);
+    }
+    atomic_fetch_add(&received, count);
+  }
+
+  return NULL;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  queue = queue_sharded_create(SHARDS, 0, sizeof(message_t), DS_LOCK_TICKET);
+}
+
+void tearDown(void)
+{
+  queue_sharded_delete(&queue);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Queue Sharded Tests");
+}
+
+/**
+ * @brief Tests the local retrieval, the stealing and the order of elements in the single thread.
+ */
+void test_TestCase_0(void)
+{
+  message_t message = {0};
+  message_t batch[BATCH];
+
+  TEST_MESSAGE("[QUEUE_TEST]: sharded order");
+
+  TEST_ASSERT_NOT_NULL(queue);
+  TEST_ASSERT_EQUAL_UINT32(SHARDS, queue_sharded_shards(queue));
+  TEST_ASSERT_TRUE(queue_sharded_home(queue) < SHARDS);
+  TEST_ASSERT_EQUAL_UINT32(queue_sharded_home(queue), queue_sharded_home(queue));
+  TEST_ASSERT_TRUE(queue_sharded_empty(queue));
+  TEST_ASSERT_FALSE(queue_sharded_get(queue, 0, &message));
+  TEST_ASSERT_EQUAL_UINT32(0, queue_sharded_get_batch(queue, 0, batch, BATCH));
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    message.producer = 1;
+    message.seq = i;
+    TEST_ASSERT_TRUE(queue_sharded_add(queue, 1, &message));
+    message.producer = 3;
+    TEST_ASSERT_TRUE(queue_sharded_add(queue, 3, &message));
+  }
+  TEST_ASSERT_EQUAL_UINT32(20, queue_sharded_size(queue));
+
+  // The consumer of the shard 3 takes its own elements first
+  TEST_ASSERT_TRUE(queue_sharded_get(queue, 3, &message));
+  TEST_ASSERT_EQUAL_UINT32(3, message.producer);
+  TEST_ASSERT_EQUAL_UINT32(0, message.seq);
+
+  // The consumer of the empty shard 0 steals half of the elements of the shard 1
+  TEST_ASSERT_EQUAL_UINT32(5, queue_sharded_get_batch(queue, 0, batch, BATCH));
+  for (uint32_t i = 0; i < 5; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(1, batch[i].producer);
+    TEST_ASSERT_EQUAL_UINT32(i, batch[i].seq);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(9, queue_sharded_get_batch(queue, 3, batch, BATCH));
+  TEST_ASSERT_EQUAL_UINT32(9, batch[8].seq);
+  // The own shard is drained, so the consumer steals half of the rest of the shard 1
+  TEST_ASSERT_EQUAL_UINT32(3, queue_sharded_get_batch(queue, 3, batch, BATCH));
+  TEST_ASSERT_EQUAL_UINT32(1, batch[0].producer);
+  TEST_ASSERT_EQUAL_UINT32(5, batch[0].seq);
+  TEST_ASSERT_EQUAL_UINT32(2, queue_sharded_size(queue));
+}
+
+/**
+ * @brief Tests that the full shard rejects the element instead of passing it to another shard.
+ */
+void test_TestCase_1(void)
+{
+  message_t message = {0};
+
+  TEST_MESSAGE("[QUEUE_TEST]: sharded limit");
+
+  queue_sharded_delete(&queue);
+  queue = queue_sharded_create(2, 3, sizeof(message_t), DS_LOCK_MUTEX);
+  TEST_ASSERT_NOT_NULL(queue);
+
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_TRUE(queue_sharded_add(queue, 0, &message));
+  }
+  TEST_ASSERT_FALSE(queue_sharded_add(queue, 0, &message));
+  TEST_ASSERT_TRUE(queue_sharded_add(queue, 1, &message));
+  TEST_ASSERT_EQUAL_UINT32(4, queue_sharded_size(queue));
+}
+
+/**
+ * @brief Tests that every element of concurrent producers is retrieved once by concurrent consumers.
+ */
+void test_TestCase_2(void)
+{
+  pthread_t threads[2 * SHARDS];
+
+  TEST_MESSAGE("[QUEUE_TEST]: sharded threads");
+
+  memset(seen, 0, sizeof(seen));
+  atomic_store(&received, 0);
+  for (uint32_t i = 0; i < SHARDS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, producer, (void*)(uintptr_t)i));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[SHARDS + i], NULL, consumer, (void*)(uintptr_t)i));
+  }
+
+  for (uint32_t i = 0; i < 2 * SHARDS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+  }
+
+  for (size_t i = 0; i < SHARDS * ELEMENTS; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(1, seen[i]);
+  }
+  TEST_ASSERT_TRUE(queue_sharded_empty(queue));
+}
@@ -0,0 +1,195 @@
+/**
+ * @file    test_queue_TestSuite6.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for Queue which checks the watermarks and the credits.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/queue/queue.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_QUEUE_LEN 10
+#define TEST_HIGH      8
+#define TEST_LOW       3
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  size_t highs;
+  size_t lows;
+  size_t size;
+} events_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static queue_t* queue = NULL;
+static events_t events = {0};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void on_watermark(const queue_t* q, bool high, void* ctx)
+{
+  events_t* e = (events_t*)ctx;
+
+  if (high)
+  {
+    e->highs++;
+  }
+  else
+  {
+    e->lows++;
+  }
+  e->size = queue_size(q);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  queue = queue_create(TEST_QUEUE_LEN, sizeof(uint32_t));
+  events = (events_t){0};
+}
+
+void tearDown(void)
+{
+  queue_delete(&queue);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Queue Backpressure Tests");
+}
+
+/**
+ * @brief Tests that the pressure changes once per crossing with hysteresis between the watermarks.
+ */
+void test_TestCase_0(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[QUEUE_TEST]: watermarks");
+
+  TEST_ASSERT_FALSE(queue_set_watermarks(queue, TEST_LOW, TEST_HIGH, on_watermark, &events));
+  TEST_ASSERT_FALSE(queue_set_watermarks(queue, TEST_QUEUE_LEN + 1, TEST_LOW, on_watermark, &events));
+  TEST_ASSERT_TRUE(queue_set_watermarks(queue, TEST_HIGH, TEST_LOW, on_watermark, &events));
+
+  for (uint32_t i = 0; i < TEST_HIGH - 1; i++)
+  {
+    TEST_ASSERT_TRUE(queue_add(queue, &i));
+  }
+  TEST_ASSERT_FALSE(queue_pressure(queue));
+  TEST_ASSERT_TRUE(queue_add(queue, &data));
+  TEST_ASSERT_TRUE(queue_pressure(queue));
+  TEST_ASSERT_EQUAL_UINT32(1, events.highs);
+  TEST_ASSERT_EQUAL_UINT32(TEST_HIGH, events.size);
+
+  // Oscillation around the high watermark doesn't release the pressure
+  for (size_t i = 0; i < 5; i++)
+  {
+    TEST_ASSERT_TRUE(queue_get(queue, &data));
+    TEST_ASSERT_TRUE(queue_add(queue, &data));
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, events.highs);
+  TEST_ASSERT_EQUAL_UINT32(0, events.lows);
+
+  while (queue_size(queue) > TEST_LOW + 1)
+  {
+    TEST_ASSERT_TRUE(queue_get(queue, &data));
+  }
+  TEST_ASSERT_TRUE(queue_pressure(queue));
+  TEST_ASSERT_TRUE(queue_get(queue, &data));
+  TEST_ASSERT_FALSE(queue_pressure(queue));
+  TEST_ASSERT_EQUAL_UINT32(1, events.lows);
+  TEST_ASSERT_EQUAL_UINT32(TEST_LOW, events.size);
+
+  while (queue_size(queue) < TEST_HIGH)
+  {
+    TEST_ASSERT_TRUE(queue_add(queue, &data));
+  }
+  TEST_ASSERT_EQUAL_UINT32(2, events.highs);
+  TEST_ASSERT_TRUE(queue_clear(queue));
+  TEST_ASSERT_EQUAL_UINT32(2, events.lows);
+
+  TEST_ASSERT_TRUE(queue_set_watermarks(queue, 0, 0, NULL, NULL));
+  TEST_ASSERT_FALSE(queue_pressure(queue));
+}
+
+/**
+ * @brief Tests that the reserved credits take the room of the queue and are spent by `queue_add_reserved` only.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[QUEUE_TEST]: credits");
+
+  TEST_ASSERT_TRUE(queue_add(queue, &data));
+  TEST_ASSERT_FALSE(queue_reserve(queue, TEST_QUEUE_LEN));
+  TEST_ASSERT_EQUAL_UINT32(0, queue_reserved(queue));
+  TEST_ASSERT_FALSE(queue_add_reserved(queue, &data));
+
+  TEST_ASSERT_TRUE(queue_reserve(queue, 6));
+  TEST_ASSERT_EQUAL_UINT32(6, queue_reserved(queue));
+
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_TRUE(queue_add(queue, &i));
+  }
+  TEST_ASSERT_TRUE(queue_full(queue));
+  TEST_ASSERT_FALSE(queue_add(queue, &data));
+  TEST_ASSERT_FALSE(queue_reserve(queue, 1));
+
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(queue_add_reserved(queue, &i));
+  }
+  TEST_ASSERT_EQUAL_UINT32(2, queue_reserved(queue));
+  TEST_ASSERT_EQUAL_UINT32(8, queue_size(queue));
+
+  // Over-release is refused and keeps the credits
+  TEST_ASSERT_FALSE(queue_release(queue, 3));
+  TEST_ASSERT_EQUAL_UINT32(2, queue_reserved(queue));
+  TEST_ASSERT_TRUE(queue_release(queue, 2));
+  TEST_ASSERT_EQUAL_UINT32(0, queue_reserved(queue));
+  TEST_ASSERT_FALSE(queue_release(queue, 1));
+  TEST_ASSERT_FALSE(queue_add_reserved(queue, &data));
+  TEST_ASSERT_TRUE(queue_add(queue, &data));
+  TEST_ASSERT_TRUE(queue_add(queue, &data));
+  TEST_ASSERT_TRUE(queue_full(queue));
+}
+
+/**
+ * @brief Tests that the reserved credits count into the load checked against the watermarks.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[QUEUE_TEST]: credits and watermarks");
+
+  TEST_ASSERT_TRUE(queue_set_watermarks(queue, TEST_HIGH, TEST_LOW, on_watermark, &events));
+
+  TEST_ASSERT_TRUE(queue_reserve(queue, TEST_HIGH));
+  TEST_ASSERT_TRUE(queue_pressure(queue));
+  TEST_ASSERT_EQUAL_UINT32(1, events.highs);
+  TEST_ASSERT_EQUAL_UINT32(0, events.size);
+
+  for (uint32_t i = 0; i < TEST_HIGH; i++)
+  {
+    TEST_ASSERT_TRUE(queue_add_reserved(queue, &i));
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, events.highs);
+
+  while (queue_get(queue, &data))
+  {
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, events.lows);
+
+  TEST_ASSERT_TRUE(queue_reserve(queue, TEST_HIGH));
+  TEST_ASSERT_TRUE(queue_release(queue, TEST_HIGH));
+  TEST_ASSERT_EQUAL_UINT32(2, events.highs);
+  TEST_ASSERT_EQUAL_UINT32(2, events.lows);
+}
@@ -129,3 +129,67 @@ void test_TestCase_5(void)
   rb_add(rb, &data);
   TEST_ASSERT_TRUE(rb_peek(rb, &data));
 }
+
+/**
+ * @brief Tests that `rb_get` returns the status together with the retrieved element.
+ *
+ * Regression test: `rb_get` used to fall off the end without returning a value. The expected behavior is
+ * `true` and the stored value for the non-empty buffer and `false` for the empty one.
+ */
+void test_TestCase_6(void)
+{
+  uint32_t data = 0x55;
+  uint32_t out = 0;
+
+  TEST_MESSAGE("[RB_TEST]: get result");
+  rb_add(rb, &data);
+  TEST_ASSERT_TRUE(rb_get(rb, &out));
+  TEST_ASSERT_EQUAL_UINT32(data, out);
+  TEST_ASSERT_FALSE(rb_get(rb, &out));
+}
+
+/**
+ * @brief Tests the behavior of the `rb_size` method after the head wraps around the end of the storage.
+ *
+ * Regression test: `rb_size` used to return the distance between the tail and the head, which is wrong when
+ * the head is behind the tail. The expected behavior is the number of stored elements in every state.
+ */
+void test_TestCase_7(void)
+{
+  uint32_t data = 0x55;
+
+  TEST_MESSAGE("[RB_TEST]: size after wrap");
+  for (size_t i = 0; i < TEST_RB_LEN - 1; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(rb, &data));
+  }
+  for (size_t i = 0; i < TEST_RB_LEN - 4; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+  }
+  for (size_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(rb, &data));
+  }
+  TEST_ASSERT_EQUAL_UINT32(13, rb_size(rb));
+  TEST_ASSERT_FALSE(rb_is_empty(rb));
+}
+
+/**
+ * @brief Tests the behavior of the `rb_delete` method for the buffer which was used.
+ *
+ * Regression test: `rb_delete` used to pass the container itself instead of the pointer to it to
+ * `container_delete`. The expected behavior is the freed buffer and the pointer set to NULL.
+ */
+void test_TestCase_8(void)
+{
+  uint32_t data = 0x55;
+
+  TEST_MESSAGE("[RB_TEST]: delete");
+  rb_add(rb, &data);
+  rb_delete(&rb);
+  TEST_ASSERT_NULL(rb);
+
+  rb = rb_create(TEST_RB_LEN, sizeof(uint32_t));
+  TEST_ASSERT_NOT_NULL(rb);
+}
@@ -0,0 +1,333 @@
+/**
+ * @file    test_rb_TestSuite10.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for asynchronous transfer of the Ring Buffer by io_uring.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/rb/ring_buffer_uring.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define RB_MAX_SIZE 1024
+#define CHUNK 256
+#define ENTRIES 8
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static char path[] = "/tmp/rb_uring_XXXXXX";
+static int file = -1;
+static uint32_t pattern[RB_MAX_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Waits until all requests are retired and returns their results.
+ */
+static size_t complete_all(rb_uring_t* uring, rb_uring_done_t* done)
+{
+  size_t total = 0;
+
+  while (rb_uring_pending(uring) > 0)
+  {
+    ptrdiff_t n = rb_uring_complete(uring, 1, done + total, ENTRIES - total);
+    TEST_ASSERT_TRUE(n >= 0);
+    total += (size_t)n;
+  }
+
+  return total;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  for (uint32_t i = 0; i < RB_MAX_SIZE; i++)
+  {
+    pattern[i] = i * 7 + 3;
+  }
+
+  strcpy(path, "/tmp/rb_uring_XXXXXX");
+  file = mkstemp(path);
+  TEST_ASSERT_TRUE(file >= 0);
+  TEST_ASSERT_EQUAL_INT(sizeof(pattern), pwrite(file, pattern, sizeof(pattern), 0));
+}
+
+void tearDown(void)
+{
+  close(file);
+  unlink(path);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("RingBuffer io_uring Tests");
+}
+
+/**
+ * @brief Tests several reads and writes in flight at the explicit offsets of the file.
+ */
+void test_TestCase_0(void)
+{
+  rb_uring_done_t done[ENTRIES];
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: file");
+
+  ring_buffer_t* rb = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+  rb_uring_t* uring = rb_uring_create(rb, ENTRIES);
+  if (NULL == uring)
+  {
+    rb_delete(&rb);
+    TEST_IGNORE_MESSAGE("io_uring isn't supported");
+  }
+
+  // Reads the first half of the file by several requests
+  for (int64_t offset = 0; offset < (int64_t)sizeof(pattern) / 2; offset += CHUNK)
+  {
+    TEST_ASSERT_TRUE(rb_uring_read(uring, file, CHUNK, offset));
+  }
+  TEST_ASSERT_EQUAL_UINT32(sizeof(pattern) / 2 / CHUNK, rb_uring_pending(uring));
+
+  size_t n = complete_all(uring, done);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(pattern) / 2 / CHUNK, n);
+  for (size_t i = 0; i < n; i++)
+  {
+    TEST_ASSERT_FALSE(done[i].write);
+    TEST_ASSERT_EQUAL_INT(CHUNK, done[i].result);
+    TEST_ASSERT_EQUAL_INT(i * CHUNK, done[i].offset);
+  }
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE / 2, rb_size(rb));
+
+  // Writes the elements back behind the end of the file
+  for (int64_t offset = sizeof(pattern); rb_uring_write(uring, file, CHUNK, offset); offset += CHUNK)
+  {
+  }
+  n = complete_all(uring, done);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(pattern) / 2 / CHUNK, n);
+  TEST_ASSERT_TRUE(done[0].write);
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+
+  uint32_t copy[RB_MAX_SIZE / 2];
+  TEST_ASSERT_EQUAL_INT(sizeof(copy), pread(file, copy, sizeof(copy), sizeof(pattern)));
+  TEST_ASSERT_EQUAL_MEMORY(pattern, copy, sizeof(copy));
+
+  // The read wraps around the end of the storage by two requests
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, sizeof(pattern), 0));
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, sizeof(pattern), RB_MAX_SIZE / 2 * sizeof(uint32_t)));
+  n = complete_all(uring, done);
+  TEST_ASSERT_EQUAL_UINT32(2, n);
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE - 1, rb_size(rb));
+  for (uint32_t i = 0; i < RB_MAX_SIZE - 1; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_EQUAL_UINT32(pattern[i], data);
+  }
+
+  rb_uring_delete(&uring);
+  TEST_ASSERT_NULL(uring);
+  rb_delete(&rb);
+}
+
+/**
+ * @brief Tests the short read which cancels the next reads.
+ */
+void test_TestCase_1(void)
+{
+  rb_uring_done_t done[ENTRIES];
+  uint8_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: short read");
+
+  TEST_ASSERT_EQUAL_INT(0, ftruncate(file, 100));
+
+  ring_buffer_t* rb = rb_create(RB_MAX_SIZE, sizeof(uint8_t));
+  rb_uring_t* uring = rb_uring_create(rb, ENTRIES);
+  if (NULL == uring)
+  {
+    rb_delete(&rb);
+    TEST_IGNORE_MESSAGE("io_uring isn't supported");
+  }
+
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, 64, 0));
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, 64, 64));
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, 64, 128));
+
+  size_t n = complete_all(uring, done);
+  TEST_ASSERT_EQUAL_UINT32(3, n);
+  TEST_ASSERT_EQUAL_INT(64, done[0].result);
+  TEST_ASSERT_EQUAL_INT(36, done[1].result);
+  TEST_ASSERT_EQUAL_INT(-ECANCELED, done[2].result);
+
+  TEST_ASSERT_EQUAL_UINT32(100, rb_size(rb));
+  for (size_t i = 0; i < 100; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_EQUAL_HEX8(((uint8_t*)pattern)[i], data);
+  }
+
+  // The end of file
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, 64, 100));
+  n = complete_all(uring, done);
+  TEST_ASSERT_EQUAL_UINT32(1, n);
+  TEST_ASSERT_EQUAL_INT(0, done[0].result);
+
+  rb_uring_delete(&uring);
+  rb_delete(&rb);
+}
+
+/**
+ * @brief Tests the pipe and the elements which are read by parts.
+ */
+void test_TestCase_2(void)
+{
+  rb_uring_done_t done[ENTRIES];
+  uint32_t data = 0;
+  int fds[2];
+
+  TEST_MESSAGE("[RB_TEST]: pipe");
+
+  TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+
+  ring_buffer_t* rb = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+  rb_uring_t* uring = rb_uring_create(rb, ENTRIES);
+  if (NULL == uring)
+  {
+    rb_delete(&rb);
+    close(fds[0]);
+    close(fds[1]);
+    TEST_IGNORE_MESSAGE("io_uring isn't supported");
+  }
+
+  TEST_ASSERT_EQUAL_INT(10, write(fds[1], pattern, 10));
+  TEST_ASSERT_TRUE(rb_uring_read(uring, fds[0], SIZE_MAX, -1));
+  TEST_ASSERT_EQUAL_UINT32(1, complete_all(uring, done));
+  TEST_ASSERT_EQUAL_INT(10, done[0].result);
+  TEST_ASSERT_EQUAL_UINT32(2, rb_size(rb));
+
+  TEST_ASSERT_EQUAL_INT(6, write(fds[1], (uint8_t*)pattern + 10, 6));
+  TEST_ASSERT_TRUE(rb_uring_read(uring, fds[0], SIZE_MAX, -1));
+  TEST_ASSERT_EQUAL_UINT32(1, complete_all(uring, done));
+  TEST_ASSERT_EQUAL_UINT32(4, rb_size(rb));
+
+  TEST_ASSERT_TRUE(rb_uring_write(uring, fds[1], SIZE_MAX, -1));
+  TEST_ASSERT_EQUAL_UINT32(1, complete_all(uring, done));
+  TEST_ASSERT_EQUAL_INT(16, done[0].result);
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+  TEST_ASSERT_FALSE(rb_uring_write(uring, fds[1], SIZE_MAX, -1));
+
+  TEST_ASSERT_TRUE(rb_uring_read(uring, fds[0], SIZE_MAX, -1));
+  TEST_ASSERT_EQUAL_UINT32(1, complete_all(uring, done));
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_EQUAL_UINT32(pattern[i], data);
+  }
+
+  rb_uring_delete(&uring);
+  rb_delete(&rb);
+  close(fds[0]);
+  close(fds[1]);
+}
+
+/**
+ * @brief Tests that the mirrored storage is read by the single request across its end.
+ */
+void test_TestCase_3(void)
+{
+  rb_uring_done_t done[ENTRIES];
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: mirrored");
+
+  ring_buffer_t* rb = rb_create_mirrored(RB_MAX_SIZE, sizeof(uint32_t));
+  TEST_ASSERT_NOT_NULL(rb);
+  rb_uring_t* uring = rb_uring_create(rb, ENTRIES);
+  if (NULL == uring)
+  {
+    rb_delete(&rb);
+    TEST_IGNORE_MESSAGE("io_uring isn't supported");
+  }
+
+  for (uint32_t i = 0; i < RB_MAX_SIZE - 10; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(rb, &i));
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+  }
+
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, 100 * sizeof(uint32_t), 0));
+  TEST_ASSERT_EQUAL_UINT32(1, complete_all(uring, done));
+  TEST_ASSERT_EQUAL_INT(100 * sizeof(uint32_t), done[0].result);
+
+  for (uint32_t i = 0; i < 100; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_EQUAL_UINT32(pattern[i], data);
+  }
+
+  rb_uring_delete(&uring);
+  rb_delete(&rb);
+}
+
+/**
+ * @brief Tests the completions which are retired by parts and the later request which completes first.
+ */
+void test_TestCase_4(void)
+{
+  rb_uring_done_t done[ENTRIES];
+  uint32_t data = 0;
+  int fds[2];
+
+  TEST_MESSAGE("[RB_TEST]: partial retirement");
+
+  TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+
+  ring_buffer_t* rb = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+  rb_uring_t* uring = rb_uring_create(rb, ENTRIES);
+  if (NULL == uring)
+  {
+    rb_delete(&rb);
+    close(fds[0]);
+    close(fds[1]);
+    TEST_IGNORE_MESSAGE("io_uring isn't supported");
+  }
+
+  // Both completions are reaped by the first call, but only one of them is retired
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, CHUNK, 0));
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, CHUNK, CHUNK));
+  TEST_ASSERT_EQUAL_INT(1, rb_uring_complete(uring, 2, done, 1));
+  TEST_ASSERT_EQUAL_INT(1, rb_uring_complete(uring, 1, done, 1));
+  TEST_ASSERT_EQUAL_INT(CHUNK, done[0].offset);
+  TEST_ASSERT_EQUAL_UINT32(0, rb_uring_pending(uring));
+  TEST_ASSERT_EQUAL_UINT32(2 * CHUNK / sizeof(uint32_t), rb_size(rb));
+  TEST_ASSERT_TRUE(rb_clear(rb));
+
+  // The read of the file completes before the older read of the pipe, so it waits for the pipe to be retired
+  TEST_ASSERT_TRUE(rb_uring_read(uring, fds[0], sizeof(uint32_t), -1));
+  TEST_ASSERT_TRUE(rb_uring_read(uring, file, CHUNK, 0));
+  TEST_ASSERT_EQUAL_INT(0, rb_uring_complete(uring, 1, done, ENTRIES));
+  TEST_ASSERT_EQUAL_UINT32(2, rb_uring_pending(uring));
+
+  TEST_ASSERT_EQUAL_INT(sizeof(uint32_t), write(fds[1], &pattern[5], sizeof(uint32_t)));
+  TEST_ASSERT_EQUAL_INT(2, rb_uring_complete(uring, 1, done, ENTRIES));
+  TEST_ASSERT_EQUAL_INT(sizeof(uint32_t), done[0].result);
+  TEST_ASSERT_EQUAL_INT(CHUNK, done[1].result);
+  TEST_ASSERT_TRUE(rb_get(rb, &data));
+  TEST_ASSERT_EQUAL_UINT32(pattern[5], data);
+  TEST_ASSERT_TRUE(rb_get(rb, &data));
+  TEST_ASSERT_EQUAL_UINT32(pattern[0], data);
+
+  rb_uring_delete(&uring);
+  rb_delete(&rb);
+  close(fds[0]);
+  close(fds[1]);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file    test_rb_TestSuite4.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for Ring Buffer which checks direct access to the storage by spans.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/rb/ring_buffer.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define RB_MAX_SIZE 16
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ring_buffer_t* rb = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  rb = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+}
+
+void tearDown(void)
+{
+  rb_delete(&rb);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("RingBuffer Spans Tests");
+}
+
+/**
+ * @brief Tests the spans of the empty ring buffer.
+ */
+void test_TestCase_0(void)
+{
+  ds_span_t first;
+  ds_span_t second;
+
+  TEST_MESSAGE("[RB_TEST]: spans of empty");
+
+  TEST_ASSERT_EQUAL_UINT32(0, rb_get_spans(rb, &first, &second));
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE - 1, rb_get_free_spans(rb, &first, &second));
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE - 1, first.count);
+  TEST_ASSERT_EQUAL_UINT32(0, second.count);
+}
+
+/**
+ * @brief Tests writing into the free spans and reading from the spans when the data wraps around the storage.
+ */
+void test_TestCase_1(void)
+{
+  ds_span_t first;
+  ds_span_t second;
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: spans of wrapped");
+
+  for (uint32_t i = 0; i < RB_MAX_SIZE / 2; i++)
+  {
+    rb_add(rb, &i);
+  }
+  TEST_ASSERT_TRUE(rb_advance_tail(rb, RB_MAX_SIZE / 2));
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+
+  size_t count = rb_get_free_spans(rb, &first, &second);
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE - 1, count);
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE / 2, first.count);
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE / 2 - 1, second.count);
+
+  for (uint32_t i = 0; i < first.count; i++)
+  {
+    ((uint32_t*)first.data)[i] = i;
+  }
+  for (uint32_t i = 0; i < second.count; i++)
+  {
+    ((uint32_t*)second.data)[i] = (uint32_t)first.count + i;
+  }
+
+  TEST_ASSERT_TRUE(rb_advance_head(rb, count));
+  TEST_ASSERT_TRUE(rb_is_full(rb));
+  TEST_ASSERT_FALSE(rb_advance_head(rb, 1));
+
+  TEST_ASSERT_EQUAL_UINT32(count, rb_get_spans(rb, &first, &second));
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE / 2, first.count);
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE / 2 - 1, second.count);
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_EQUAL_UINT32(i, data);
+  }
+
+  TEST_ASSERT_FALSE(rb_advance_tail(rb, 1));
+}
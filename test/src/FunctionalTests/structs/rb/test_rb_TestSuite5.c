@@ -0,0 +1,176 @@
+/**
+ * @file    test_rb_TestSuite5.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for Ring Buffer placed in the memory mapped file.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_cursor.h"
+#include "structs/rb/ring_buffer.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define RB_MAX_SIZE 16
+#define RB_FILE_PATH "test_rb_mapped.bin"
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ring_buffer_t* rb = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  remove(RB_FILE_PATH);
+  rb = rb_create_mapped(RB_FILE_PATH, RB_MAX_SIZE, sizeof(uint32_t));
+}
+
+void tearDown(void)
+{
+  if (NULL != rb)
+  {
+    rb_delete(&rb);
+  }
+  remove(RB_FILE_PATH);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("RingBuffer Mapped File Tests");
+}
+
+/**
+ * @brief Tests that the elements survive reopening of the file.
+ */
+void test_TestCase_0(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: reopen");
+
+  TEST_ASSERT_NOT_NULL(rb);
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+
+  for (uint32_t i = 0; i < RB_MAX_SIZE + 4; i++)
+  {
+    if (rb_is_full(rb))
+    {
+      TEST_ASSERT_TRUE(rb_get(rb, &data));
+    }
+    TEST_ASSERT_TRUE(rb_add(rb, &i));
+  }
+
+  TEST_ASSERT_TRUE(rb_flush(rb));
+  rb_delete(&rb);
+
+  rb = rb_create_mapped(RB_FILE_PATH, RB_MAX_SIZE, sizeof(uint32_t));
+  TEST_ASSERT_NOT_NULL(rb);
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE - 1, rb_size(rb));
+
+  for (uint32_t i = 5; i < RB_MAX_SIZE + 4; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_EQUAL_UINT32(i, data);
+  }
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+}
+
+/**
+ * @brief Tests that the file created with other parameters or corrupted is rejected.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t data = 7;
+
+  TEST_MESSAGE("[RB_TEST]: validation");
+
+  TEST_ASSERT_NOT_NULL(rb);
+  TEST_ASSERT_TRUE(rb_add(rb, &data));
+  rb_delete(&rb);
+
+  TEST_ASSERT_NULL(rb_create_mapped(RB_FILE_PATH, RB_MAX_SIZE, sizeof(uint16_t)));
+  TEST_ASSERT_NULL(rb_create_mapped(RB_FILE_PATH, RB_MAX_SIZE * 2, sizeof(uint32_t)));
+
+  FILE* file = fopen(RB_FILE_PATH, "r+b");
+  TEST_ASSERT_NOT_NULL(file);
+  uint32_t magic = 0xDEADBEEF;
+  fwrite(&magic, sizeof(magic), 1, file);
+  fclose(file);
+
+  TEST_ASSERT_NULL(rb_create_mapped(RB_FILE_PATH, RB_MAX_SIZE, sizeof(uint32_t)));
+}
+
+/**
+ * @brief Tests the sync policies and the direct access to the mapped storage.
+ */
+void test_TestCase_2(void)
+{
+  ds_span_t first;
+  ds_span_t second;
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: sync policies");
+
+  ring_buffer_t* heap = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+  TEST_ASSERT_FALSE(rb_set_sync(heap, RB_SYNC_FULL));
+  TEST_ASSERT_TRUE(rb_flush(heap));
+  rb_delete(&heap);
+
+  TEST_ASSERT_TRUE(rb_set_sync(rb, RB_SYNC_FULL));
+  TEST_ASSERT_EQUAL_UINT32(RB_MAX_SIZE - 1, rb_get_free_spans(rb, &first, &second));
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    ((uint32_t*)first.data)[i] = i * 10;
+  }
+  TEST_ASSERT_TRUE(rb_advance_head(rb, 4));
+
+  TEST_ASSERT_TRUE(rb_set_sync(rb, RB_SYNC_ASYNC));
+  TEST_ASSERT_TRUE(rb_get(rb, &data));
+  TEST_ASSERT_EQUAL_UINT32(0, data);
+
+  rb_delete(&rb);
+  rb = rb_create_mapped(RB_FILE_PATH, RB_MAX_SIZE, sizeof(uint32_t));
+  TEST_ASSERT_NOT_NULL(rb);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, rb);
+  for (uint32_t i = 1; i < 4; i++)
+  {
+    uint32_t* element = (uint32_t*)ds_cursor_next(&cursor);
+    TEST_ASSERT_NOT_NULL(element);
+    TEST_ASSERT_EQUAL_UINT32(i * 10, *element);
+  }
+  TEST_ASSERT_NULL(ds_cursor_next(&cursor));
+}
+
+/**
+ * @brief Tests that the file of the previous layout whose indexes aren't aligned to the cache line is rejected.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t data = 7;
+
+  TEST_MESSAGE("[RB_TEST]: previous layout");
+
+  TEST_ASSERT_NOT_NULL(rb);
+  TEST_ASSERT_TRUE(rb_add(rb, &data));
+  rb_delete(&rb);
+
+  FILE* file = fopen(RB_FILE_PATH, "r+b");
+  TEST_ASSERT_NOT_NULL(file);
+  uint32_t version = 1;
+  fseek(file, sizeof(uint32_t), SEEK_SET);
+  fwrite(&version, sizeof(version), 1, file);
+  fclose(file);
+
+  TEST_ASSERT_NULL(rb_create_mapped(RB_FILE_PATH, RB_MAX_SIZE, sizeof(uint32_t)));
+}
@@ -0,0 +1,183 @@
+/**
+ * @file    test_rb_TestSuite6.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for Ring Buffer placed in the shared memory.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/rb/ring_buffer.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define RB_MAX_SIZE 64
+#define RB_SHM_NAME "/uds_test_rb_shared"
+#define PRODUCERS 4
+#define ELEMENTS_PER_PRODUCER 20000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  ring_buffer_t* rb;
+  uint32_t id;
+} producer_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ring_buffer_t* producer = NULL;
+static ring_buffer_t* consumer = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void* produce(void* arg)
+{
+  producer_t* self = (producer_t*)arg;
+
+  for (uint32_t i = 0; i < ELEMENTS_PER_PRODUCER; i++)
+  {
+    uint32_t data = (self->id << 24) | i;
+    while (!rb_add(self->rb, &data))
+    {
+      sched_yield();
+    }
+  }
+
+  return NULL;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  rb_unlink_shared(RB_SHM_NAME);
+}
+
+void tearDown(void)
+{
+  if (NULL != producer)
+  {
+    rb_delete(&producer);
+  }
+  if (NULL != consumer)
+  {
+    rb_delete(&consumer);
+  }
+  rb_unlink_shared(RB_SHM_NAME);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("RingBuffer Shared Memory Tests");
+}
+
+/**
+ * @brief Tests the exchange of elements between the creator and the attached ring buffer.
+ */
+void test_TestCase_0(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: create and attach");
+
+  producer = rb_create_shared(RB_SHM_NAME, RB_MAX_SIZE, sizeof(uint32_t), RB_SHARED_SPSC);
+  TEST_ASSERT_NOT_NULL(producer);
+  consumer = rb_attach_shared(RB_SHM_NAME);
+  TEST_ASSERT_NOT_NULL(consumer);
+  TEST_ASSERT_TRUE(rb_is_empty(consumer));
+
+  for (uint32_t i = 0; i < 3 * RB_MAX_SIZE; i++)
+  {
+    if (rb_is_full(producer))
+    {
+      TEST_ASSERT_TRUE(rb_get(consumer, &data));
+      TEST_ASSERT_EQUAL_UINT32(i - (RB_MAX_SIZE - 1), data);
+    }
+    TEST_ASSERT_TRUE(rb_add(producer, &i));
+    TEST_ASSERT_EQUAL_UINT32(rb_size(producer), rb_size(consumer));
+  }
+
+  TEST_ASSERT_TRUE(rb_is_full(consumer));
+  rb_delete(&producer);
+
+  for (uint32_t i = 2 * RB_MAX_SIZE + 1; i < 3 * RB_MAX_SIZE; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(consumer, &data));
+    TEST_ASSERT_EQUAL_UINT32(i, data);
+  }
+  TEST_ASSERT_FALSE(rb_get(consumer, &data));
+}
+
+/**
+ * @brief Tests that the elements added by several producers are retrieved once and in order per producer.
+ */
+void test_TestCase_1(void)
+{
+  pthread_t threads[PRODUCERS];
+  producer_t producers[PRODUCERS];
+  uint32_t expected[PRODUCERS] = {0};
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: multiple producers");
+
+  producer = rb_create_shared(RB_SHM_NAME, RB_MAX_SIZE, sizeof(uint32_t), RB_SHARED_MPSC);
+  TEST_ASSERT_NOT_NULL(producer);
+  consumer = rb_attach_shared(RB_SHM_NAME);
+  TEST_ASSERT_NOT_NULL(consumer);
+
+  for (uint32_t i = 0; i < PRODUCERS; i++)
+  {
+    producers[i].rb = producer;
+    producers[i].id = i;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, produce, &producers[i]));
+  }
+
+  for (uint32_t received = 0; received < PRODUCERS * ELEMENTS_PER_PRODUCER;)
+  {
+    if (!rb_get(consumer, &data))
+    {
+      sched_yield();
+      continue;
+    }
+
+    uint32_t id = data >> 24;
+    TEST_ASSERT_LESS_THAN_UINT32(PRODUCERS, id);
+    TEST_ASSERT_EQUAL_UINT32(expected[id], data & 0xFFFFFFU);
+    expected[id]++;
+    received++;
+  }
+
+  for (uint32_t i = 0; i < PRODUCERS; i++)
+  {
+    pthread_join(threads[i], NULL);
+  }
+
+  TEST_ASSERT_TRUE(rb_is_empty(consumer));
+}
+
+/**
+ * @brief Tests the errors of creation and attaching.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[RB_TEST]: errors");
+
+  TEST_ASSERT_NULL(rb_attach_shared(RB_SHM_NAME));
+
+  producer = rb_create_shared(RB_SHM_NAME, RB_MAX_SIZE, sizeof(uint32_t), RB_SHARED_SPSC);
+  TEST_ASSERT_NOT_NULL(producer);
+  TEST_ASSERT_NULL(rb_create_shared(RB_SHM_NAME, RB_MAX_SIZE, sizeof(uint32_t), RB_SHARED_SPSC));
+
+  TEST_ASSERT_TRUE(rb_unlink_shared(RB_SHM_NAME));
+  TEST_ASSERT_FALSE(rb_unlink_shared(RB_SHM_NAME));
+  TEST_ASSERT_NULL(rb_attach_shared(RB_SHM_NAME));
+
+  uint32_t data = 42;
+  TEST_ASSERT_TRUE(rb_add(producer, &data));
+  TEST_ASSERT_TRUE(rb_get(producer, &data));
+  TEST_ASSERT_EQUAL_UINT32(42, data);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file    test_rb_TestSuite7.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for mirrored Ring Buffer and batch operations.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_cursor.h"
+#include "structs/rb/ring_buffer.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define RB_MAX_SIZE 100
+#define BATCH_SIZE 2048
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ring_buffer_t* rb = NULL;
+static uint32_t input[BATCH_SIZE];
+static uint32_t output[BATCH_SIZE];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  rb = rb_create_mirrored(RB_MAX_SIZE, sizeof(uint32_t));
+
+  for (uint32_t i = 0; i < BATCH_SIZE; i++)
+  {
+    input[i] = i * 3 + 1;
+  }
+  memset(output, 0, sizeof(output));
+}
+
+void tearDown(void)
+{
+  if (NULL != rb)
+  {
+    rb_delete(&rb);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("RingBuffer Mirrored Tests");
+}
+
+/**
+ * @brief Tests that the size is rounded up to whole pages and the free slots form one span.
+ */
+void test_TestCase_0(void)
+{
+  ds_span_t first;
+  ds_span_t second;
+
+  TEST_MESSAGE("[RB_TEST]: mirrored capacity");
+
+  TEST_ASSERT_NOT_NULL(rb);
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+
+  size_t capacity = rb_get_free_spans(rb, &first, &second);
+  TEST_ASSERT_TRUE(capacity >= RB_MAX_SIZE - 1);
+  TEST_ASSERT_EQUAL_UINT32(0, second.count);
+  TEST_ASSERT_EQUAL_UINT32(capacity, first.count);
+  TEST_ASSERT_EQUAL_UINT32(0, ((capacity + 1) * sizeof(uint32_t)) % 4096);
+}
+
+/**
+ * @brief Tests that the elements which wrap around the end of the storage are returned as one span.
+ */
+void test_TestCase_1(void)
+{
+  ds_span_t first;
+  ds_span_t second;
+
+  TEST_MESSAGE("[RB_TEST]: contiguous wrap");
+
+  TEST_ASSERT_NOT_NULL(rb);
+
+  size_t capacity = rb_get_free_spans(rb, &first, &second);
+  TEST_ASSERT_TRUE(capacity <= BATCH_SIZE);
+
+  // Moves the tail close to the end of the storage
+  TEST_ASSERT_TRUE(rb_add_batch(rb, input, capacity - 3));
+  TEST_ASSERT_TRUE(rb_advance_tail(rb, capacity - 3));
+
+  TEST_ASSERT_EQUAL_UINT32(capacity, rb_get_free_spans(rb, &first, &second));
+  TEST_ASSERT_EQUAL_UINT32(0, second.count);
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(rb, &input[i]));
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(10, rb_get_spans(rb, &first, &second));
+  TEST_ASSERT_EQUAL_UINT32(10, first.count);
+  TEST_ASSERT_EQUAL_UINT32(0, second.count);
+  TEST_ASSERT_EQUAL_UINT32_ARRAY(input, first.data, 10);
+
+  ds_cursor_t cursor;
+  ds_cursor_init(&cursor, rb);
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    uint32_t* element = (uint32_t*)ds_cursor_next(&cursor);
+    TEST_ASSERT_NOT_NULL(element);
+    TEST_ASSERT_EQUAL_UINT32(input[i], *element);
+  }
+  TEST_ASSERT_NULL(ds_cursor_next(&cursor));
+}
+
+/**
+ * @brief Tests the batch operations of the mirrored and the ordinary ring buffers.
+ */
+void test_TestCase_2(void)
+{
+  ds_span_t first;
+  ds_span_t second;
+
+  TEST_MESSAGE("[RB_TEST]: batch");
+
+  ring_buffer_t* heap = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+  ring_buffer_t* buffers[] = {rb, heap};
+
+  for (size_t b = 0; b < 2; b++)
+  {
+    ring_buffer_t* current = buffers[b];
+    TEST_ASSERT_NOT_NULL(current);
+
+    size_t capacity = rb_get_free_spans(current, &first, &second);
+    size_t part = capacity / 3 * 2;
+
+    TEST_ASSERT_FALSE(rb_add_batch(current, input, capacity + 1));
+    TEST_ASSERT_TRUE(rb_is_empty(current));
+
+    for (uint32_t round = 0; round < 4; round++)
+    {
+      TEST_ASSERT_TRUE(rb_add_batch(current, input, part));
+      TEST_ASSERT_EQUAL_UINT32(part, rb_size(current));
+      TEST_ASSERT_FALSE(rb_get_batch(current, output, part + 1));
+
+      memset(output, 0, sizeof(output));
+      TEST_ASSERT_TRUE(rb_get_batch(current, output, part));
+      TEST_ASSERT_EQUAL_UINT32_ARRAY(input, output, part);
+      TEST_ASSERT_TRUE(rb_is_empty(current));
+    }
+
+    TEST_ASSERT_TRUE(rb_add_batch(current, input, 0));
+    TEST_ASSERT_TRUE(rb_get_batch(current, output, 0));
+  }
+
+  rb_delete(&heap);
+}
@@ -0,0 +1,156 @@
+/**
+ * @file    test_rb_TestSuite8.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for records of variable length in Ring Buffer.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/rb/ring_buffer.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define RB_MAX_SIZE 256
+#define RECORDS 1000
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ring_buffer_t* rb = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Fills the payload of the record `n`, the length varies from 0 to 60 bytes.
+ */
+static size_t make_record(uint32_t n, uint8_t* payload)
+{
+  size_t length = (n * 7) % 61;
+
+  for (size_t i = 0; i < length; i++)
+  {
+    payload[i] = (uint8_t)(n + i);
+  }
+
+  return length;
+}
+
+/**
+ * @brief Streams the records through the ring buffer, keeping up to three of them in it.
+ */
+static void check_stream(ring_buffer_t* buffer)
+{
+  uint8_t payload[64];
+  uint8_t expected[64];
+  uint32_t written = 0;
+  uint32_t read = 0;
+
+  while (read < RECORDS)
+  {
+    while (written < RECORDS && written - read < 3)
+    {
+      size_t length = make_record(written, payload);
+      TEST_ASSERT_TRUE(rb_write_record(buffer, payload, length));
+      written++;
+    }
+
+    rb_record_t record;
+    TEST_ASSERT_TRUE(rb_peek_record(buffer, &record));
+    TEST_ASSERT_EQUAL_UINT32(make_record(read, expected), record.length);
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)record.data % RB_RECORD_ALIGN);
+    if (0 != record.length)
+    {
+      TEST_ASSERT_EQUAL_MEMORY(expected, record.data, record.length);
+    }
+    TEST_ASSERT_TRUE(rb_release_record(buffer));
+    read++;
+  }
+
+  TEST_ASSERT_TRUE(rb_is_empty(buffer));
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  rb = rb_create(RB_MAX_SIZE, sizeof(uint8_t));
+}
+
+void tearDown(void)
+{
+  if (NULL != rb)
+  {
+    rb_delete(&rb);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("RingBuffer Records Tests");
+}
+
+/**
+ * @brief Tests the records which wrap around the end of the storage.
+ */
+void test_TestCase_0(void)
+{
+  TEST_MESSAGE("[RB_TEST]: records stream");
+
+  TEST_ASSERT_NOT_NULL(rb);
+  check_stream(rb);
+}
+
+/**
+ * @brief Tests the records in the mirrored storage.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[RB_TEST]: records in mirrored storage");
+
+  ring_buffer_t* mirrored = rb_create_mirrored(RB_MAX_SIZE, sizeof(uint8_t));
+  TEST_ASSERT_NOT_NULL(mirrored);
+  check_stream(mirrored);
+  rb_delete(&mirrored);
+}
+
+/**
+ * @brief Tests the copying read, the full ring buffer and the too small buffer.
+ */
+void test_TestCase_2(void)
+{
+  char line[RB_MAX_SIZE];
+  size_t length = 0;
+  uint32_t count = 0;
+
+  TEST_MESSAGE("[RB_TEST]: records errors");
+
+  TEST_ASSERT_FALSE(rb_read_record(rb, line, sizeof(line), &length));
+  TEST_ASSERT_EQUAL_UINT32(0, length);
+  TEST_ASSERT_FALSE(rb_write_record(rb, line, RB_MAX_SIZE));
+
+  while (rb_write_record(rb, "log line", 9))
+  {
+    count++;
+  }
+  // Every record occupies the header and 16 bytes of payload, one byte is always free
+  TEST_ASSERT_EQUAL_UINT32((RB_MAX_SIZE - RB_RECORD_ALIGN) / (RB_RECORD_ALIGN + 16), count);
+
+  TEST_ASSERT_FALSE(rb_read_record(rb, line, 4, &length));
+  TEST_ASSERT_EQUAL_UINT32(9, length);
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    TEST_ASSERT_TRUE(rb_read_record(rb, line, sizeof(line), &length));
+    TEST_ASSERT_EQUAL_UINT32(9, length);
+    TEST_ASSERT_EQUAL_STRING("log line", line);
+  }
+
+  TEST_ASSERT_TRUE(rb_write_record(rb, NULL, 0));
+  TEST_ASSERT_TRUE(rb_read_record(rb, NULL, 0, &length));
+  TEST_ASSERT_EQUAL_UINT32(0, length);
+  TEST_ASSERT_TRUE(rb_is_empty(rb));
+}
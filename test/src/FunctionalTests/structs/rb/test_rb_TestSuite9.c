@@ -0,0 +1,175 @@
+/**
+ * @file    test_rb_TestSuite9.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for transfer of the Ring Buffer from and to the file descriptors.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/rb/ring_buffer.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define RB_MAX_SIZE 64
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static int fds[2] = {-1, -1};
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+}
+
+void tearDown(void)
+{
+  close(fds[0]);
+  close(fds[1]);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("RingBuffer I/O Tests");
+}
+
+/**
+ * @brief Tests the transfer of the elements which wrap around the end of the storage through the pipe.
+ */
+void test_TestCase_0(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: pipe");
+
+  ring_buffer_t* src = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+  ring_buffer_t* dst = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+
+  // Moves the indexes close to the end of the storage
+  for (uint32_t i = 0; i < RB_MAX_SIZE - 10; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(src, &i));
+    TEST_ASSERT_TRUE(rb_get(src, &data));
+    TEST_ASSERT_TRUE(rb_add(dst, &i));
+    TEST_ASSERT_TRUE(rb_get(dst, &data));
+  }
+
+  for (uint32_t i = 0; i < 40; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(src, &i));
+  }
+
+  TEST_ASSERT_EQUAL_INT(40 * sizeof(uint32_t), rb_write_to_fd(src, fds[1], SIZE_MAX));
+  TEST_ASSERT_TRUE(rb_is_empty(src));
+  errno = 0;
+  TEST_ASSERT_EQUAL_INT(-1, rb_write_to_fd(src, fds[1], SIZE_MAX));
+  TEST_ASSERT_EQUAL_INT(ENODATA, errno);
+
+  TEST_ASSERT_EQUAL_INT(40 * sizeof(uint32_t), rb_read_from_fd(dst, fds[0], SIZE_MAX));
+  TEST_ASSERT_EQUAL_UINT32(40, rb_size(dst));
+  for (uint32_t i = 0; i < 40; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(dst, &data));
+    TEST_ASSERT_EQUAL_UINT32(i, data);
+  }
+
+  // The end of file
+  close(fds[1]);
+  fds[1] = -1;
+  TEST_ASSERT_EQUAL_INT(0, rb_read_from_fd(dst, fds[0], SIZE_MAX));
+
+  rb_delete(&src);
+  rb_delete(&dst);
+}
+
+/**
+ * @brief Tests the elements which are transferred by parts.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[RB_TEST]: partial elements");
+
+  ring_buffer_t* src = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+  ring_buffer_t* dst = rb_create(RB_MAX_SIZE, sizeof(uint32_t));
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(src, &i));
+  }
+
+  // The element stays in the ring buffer until all its bytes are written
+  TEST_ASSERT_EQUAL_INT(6, rb_write_to_fd(src, fds[1], 6));
+  TEST_ASSERT_EQUAL_UINT32(9, rb_size(src));
+  TEST_ASSERT_EQUAL_INT(2, rb_write_to_fd(src, fds[1], 2));
+  TEST_ASSERT_EQUAL_UINT32(8, rb_size(src));
+
+  // The element is added when all its bytes are read
+  TEST_ASSERT_EQUAL_INT(3, rb_read_from_fd(dst, fds[0], 3));
+  TEST_ASSERT_TRUE(rb_is_empty(dst));
+  TEST_ASSERT_EQUAL_INT(3, rb_read_from_fd(dst, fds[0], 3));
+  TEST_ASSERT_EQUAL_UINT32(1, rb_size(dst));
+  TEST_ASSERT_EQUAL_INT(2, rb_read_from_fd(dst, fds[0], SIZE_MAX));
+  TEST_ASSERT_EQUAL_UINT32(2, rb_size(dst));
+
+  for (uint32_t i = 0; i < 2; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(dst, &data));
+    TEST_ASSERT_EQUAL_UINT32(i, data);
+  }
+
+  rb_delete(&src);
+  rb_delete(&dst);
+}
+
+/**
+ * @brief Tests the full ring buffer and the non-blocking socket without data.
+ */
+void test_TestCase_2(void)
+{
+  int sv[2];
+  uint8_t byte = 0x5A;
+
+  TEST_MESSAGE("[RB_TEST]: full and would block");
+
+  TEST_ASSERT_EQUAL_INT(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sv));
+  TEST_ASSERT_EQUAL_INT(0, fcntl(sv[0], F_SETFL, fcntl(sv[0], F_GETFL) | O_NONBLOCK));
+
+  ring_buffer_t* rb = rb_create(RB_MAX_SIZE, sizeof(uint8_t));
+
+  errno = 0;
+  TEST_ASSERT_EQUAL_INT(-1, rb_read_from_fd(rb, sv[0], SIZE_MAX));
+  TEST_ASSERT_TRUE(EAGAIN == errno || EWOULDBLOCK == errno);
+
+  for (size_t i = 0; i < RB_MAX_SIZE; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(1, write(sv[1], &byte, 1));
+  }
+
+  TEST_ASSERT_EQUAL_INT(RB_MAX_SIZE - 1, rb_read_from_fd(rb, sv[0], SIZE_MAX));
+  TEST_ASSERT_TRUE(rb_is_full(rb));
+  errno = 0;
+  TEST_ASSERT_EQUAL_INT(-1, rb_read_from_fd(rb, sv[0], SIZE_MAX));
+  TEST_ASSERT_EQUAL_INT(ENOBUFS, errno);
+
+  TEST_ASSERT_EQUAL_INT(RB_MAX_SIZE - 1, rb_write_to_fd(rb, fds[1], SIZE_MAX));
+  TEST_ASSERT_EQUAL_INT(1, rb_read_from_fd(rb, sv[0], SIZE_MAX));
+  TEST_ASSERT_EQUAL_UINT32(1, rb_size(rb));
+
+  rb_delete(&rb);
+  close(sv[0]);
+  close(sv[1]);
+}
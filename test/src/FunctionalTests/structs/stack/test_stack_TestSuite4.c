@@ -0,0 +1,167 @@
+/**
+ * @file    test_stack_TestSuite4.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for Stack with inline storage.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_INLINE_LEN  8
+#define TEST_SPILLED_LEN 100
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static stack_t* stack = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  stack = stack_create_inline(0, sizeof(uint32_t), TEST_INLINE_LEN * sizeof(uint32_t));
+}
+
+void tearDown(void)
+{
+  stack_delete(&stack);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Stack Inline Storage Tests");
+}
+
+void test_TestCase_0(void)
+{
+  TEST_MESSAGE("[STACK_TEST]: create inline");
+  TEST_ASSERT_NOT_NULL(stack);
+  TEST_ASSERT_TRUE(stack_empty(stack));
+}
+
+/**
+ * @brief Tests the push and pop operations of the stack which fits into the inline buffer.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t output = 0;
+
+  TEST_MESSAGE("[STACK_TEST]: push/pop inline");
+
+  for (uint32_t i = 0; i < TEST_INLINE_LEN; i++)
+  {
+    TEST_ASSERT_TRUE(stack_push(stack, &i));
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(TEST_INLINE_LEN, stack_size(stack));
+
+  for (uint32_t i = TEST_INLINE_LEN; i > 0; i--)
+  {
+    TEST_ASSERT_TRUE(stack_pop(stack, &output));
+    TEST_ASSERT_EQUAL_UINT32(i - 1, output);
+  }
+
+  TEST_ASSERT_FALSE(stack_pop(stack, &output));
+}
+
+/**
+ * @brief Tests that the elements are kept in the right order after the stack spills out of the inline buffer.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t output = 0;
+
+  TEST_MESSAGE("[STACK_TEST]: push/pop spilled");
+
+  for (uint32_t i = 0; i < TEST_SPILLED_LEN; i++)
+  {
+    TEST_ASSERT_TRUE(stack_push(stack, &i));
+    TEST_ASSERT_TRUE(stack_peek(stack, &output));
+    TEST_ASSERT_EQUAL_UINT32(i, output);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(TEST_SPILLED_LEN, stack_size(stack));
+
+  for (uint32_t i = TEST_SPILLED_LEN; i > 0; i--)
+  {
+    TEST_ASSERT_TRUE(stack_pop(stack, &output));
+    TEST_ASSERT_EQUAL_UINT32(i - 1, output);
+  }
+
+  TEST_ASSERT_TRUE(stack_empty(stack));
+}
+
+/**
+ * @brief Tests that the limited stack with inline storage respects its size.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t data = 0x55;
+
+  TEST_MESSAGE("[STACK_TEST]: limited inline");
+
+  stack_t* l_stack = stack_create_inline(TEST_INLINE_LEN * 2, sizeof(uint32_t), TEST_INLINE_LEN * sizeof(uint32_t));
+
+  for (size_t i = 0; i < TEST_INLINE_LEN * 2; i++)
+  {
+    TEST_ASSERT_TRUE(stack_push(l_stack, &data));
+  }
+
+  TEST_ASSERT_TRUE(stack_full(l_stack));
+  TEST_ASSERT_FALSE(stack_push(l_stack, &data));
+
+  stack_delete(&l_stack);
+}
+
+/**
+ * @brief Tests the in place access to the top element via `stack_emplace` and `stack_top_ptr`.
+ */
+void test_TestCase_4(void)
+{
+  uint32_t output = 0;
+
+  TEST_MESSAGE("[STACK_TEST]: emplace/top_ptr");
+
+  TEST_ASSERT_NULL(stack_top_ptr(stack));
+
+  for (uint32_t i = 0; i < TEST_SPILLED_LEN; i++)
+  {
+    uint32_t* slot = (uint32_t*)stack_emplace(stack);
+    TEST_ASSERT_NOT_NULL(slot);
+    *slot = i;
+    TEST_ASSERT_EQUAL_PTR(slot, stack_top_ptr(stack));
+  }
+
+  uint32_t* top = (uint32_t*)stack_top_ptr(stack);
+  TEST_ASSERT_EQUAL_UINT32(TEST_SPILLED_LEN - 1, *top);
+  *top = 0x55;
+
+  TEST_ASSERT_TRUE(stack_pop(stack, &output));
+  TEST_ASSERT_EQUAL_UINT32(0x55, output);
+  TEST_ASSERT_EQUAL_UINT32(TEST_SPILLED_LEN - 2, *(uint32_t*)stack_top_ptr(stack));
+}
+
+/**
+ * @brief Tests that the elements of the inline buffer are aligned for any type.
+ */
+void test_TestCase_5(void)
+{
+  max_align_t data = {0};
+
+  TEST_MESSAGE("[STACK_TEST]: inline alignment");
+
+  stack_t* l_stack = stack_create_inline(0, sizeof(max_align_t), 4 * sizeof(max_align_t));
+  TEST_ASSERT_TRUE(stack_push(l_stack, &data));
+  TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)stack_top_ptr(l_stack) % _Alignof(max_align_t));
+
+  stack_delete(&l_stack);
+}
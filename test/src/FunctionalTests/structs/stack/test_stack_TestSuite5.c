@@ -0,0 +1,140 @@
+/**
+ * @file    test_stack_TestSuite5.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for Stack which checks the management of the stack storage.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_RESERVED_LEN 20
+#define TEST_STACK_LEN    200
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static stack_t* stack = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  stack = stack_create(0, sizeof(uint32_t));
+}
+
+void tearDown(void)
+{
+  stack_delete(&stack);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Stack Storage Tests");
+}
+
+/**
+ * @brief Tests that the stack with `STACK_GROWTH_NONE` policy holds exactly the reserved number of elements.
+ */
+void test_TestCase_0(void)
+{
+  uint32_t data = 0x55;
+
+  TEST_MESSAGE("[STACK_TEST]: reserve");
+
+  TEST_ASSERT_TRUE(stack_set_growth(stack, STACK_GROWTH_NONE, 0));
+  TEST_ASSERT_FALSE(stack_push(stack, &data));
+  TEST_ASSERT_TRUE(stack_reserve(stack, TEST_RESERVED_LEN));
+
+  for (size_t i = 0; i < TEST_RESERVED_LEN; i++)
+  {
+    TEST_ASSERT_TRUE(stack_push(stack, &data));
+  }
+
+  TEST_ASSERT_FALSE(stack_push(stack, &data));
+}
+
+/**
+ * @brief Tests the invalid arguments of `stack_set_growth` and `stack_set_autoshrink`.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[STACK_TEST]: invalid growth policy");
+
+  TEST_ASSERT_FALSE(stack_set_growth(stack, STACK_GROWTH_GEOMETRIC, 1));
+  TEST_ASSERT_FALSE(stack_set_growth(stack, STACK_GROWTH_LINEAR, 0));
+  TEST_ASSERT_FALSE(stack_set_autoshrink(stack, 2));
+  TEST_ASSERT_TRUE(stack_set_autoshrink(stack, 0));
+}
+
+/**
+ * @brief Tests that the stack with linear growth and automatic shrinking keeps the right order of elements.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t output = 0;
+
+  TEST_MESSAGE("[STACK_TEST]: linear growth and autoshrink");
+
+  TEST_ASSERT_TRUE(stack_set_growth(stack, STACK_GROWTH_LINEAR, 16));
+  TEST_ASSERT_TRUE(stack_set_autoshrink(stack, 4));
+
+  for (uint32_t i = 0; i < TEST_STACK_LEN; i++)
+  {
+    TEST_ASSERT_TRUE(stack_push(stack, &i));
+  }
+
+  for (uint32_t i = TEST_STACK_LEN; i > 0; i--)
+  {
+    TEST_ASSERT_TRUE(stack_pop(stack, &output));
+    TEST_ASSERT_EQUAL_UINT32(i - 1, output);
+  }
+
+  TEST_ASSERT_TRUE(stack_empty(stack));
+}
+
+/**
+ * @brief Tests that `stack_shrink_to_fit` keeps the elements and the stack can grow again after it.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t output = 0;
+
+  TEST_MESSAGE("[STACK_TEST]: shrink to fit");
+
+  for (uint32_t i = 0; i < TEST_STACK_LEN; i++)
+  {
+    stack_push(stack, &i);
+  }
+
+  for (uint32_t i = 0; i < TEST_STACK_LEN / 2; i++)
+  {
+    stack_pop(stack, &output);
+  }
+
+  TEST_ASSERT_TRUE(stack_shrink_to_fit(stack));
+  TEST_ASSERT_EQUAL_UINT32(TEST_STACK_LEN / 2, stack_size(stack));
+  TEST_ASSERT_TRUE(stack_peek(stack, &output));
+  TEST_ASSERT_EQUAL_UINT32(TEST_STACK_LEN / 2 - 1, output);
+
+  for (uint32_t i = TEST_STACK_LEN / 2; i < TEST_STACK_LEN; i++)
+  {
+    TEST_ASSERT_TRUE(stack_push(stack, &i));
+  }
+
+  for (uint32_t i = TEST_STACK_LEN; i > 0; i--)
+  {
+    TEST_ASSERT_TRUE(stack_pop(stack, &output));
+    TEST_ASSERT_EQUAL_UINT32(i - 1, output);
+  }
+
+  TEST_ASSERT_TRUE(stack_clear(stack));
+  TEST_ASSERT_TRUE(stack_shrink_to_fit(stack));
+}
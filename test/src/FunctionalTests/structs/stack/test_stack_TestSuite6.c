@@ -0,0 +1,177 @@
+/**
+ * @file    test_stack_TestSuite6.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for lock-free Stack.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/stack/stack_lf.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define THREADS  4
+#define ELEMENTS 50000
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static stack_lf_t* stack = NULL;
+static uint8_t seen[THREADS * ELEMENTS];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void* pusher(void* arg)
+{
+  uint32_t base = (uint32_t)(uintptr_t)arg * ELEMENTS;
+
+  for (uint32_t i = 0; i < ELEMENTS; i++)
+  {
+    uint32_t data = base + i;
+    TEST_ASSERT_TRUE(stack_lf_push(stack, &data));
+  }
+
+  return NULL;
+}
+
+static void* popper(void* arg)
+{
+  uint32_t data = 0;
+  size_t popped = 0;
+
+  (void)arg;
+  while (popped < ELEMENTS)
+  {
+    if (stack_lf_pop(stack, &data))
+    {
+      TEST_ASSERT_TRUE(data < THREADS * ELEMENTS);
+      __atomic_fetch_add(&seen[data], 1, __ATOMIC_RELAXED);
+      popped++;
+    }
+  }
+
+  return NULL;
+}
+
+static void* mixer(void* arg)
+{
+  uint32_t base = (uint32_t)(uintptr_t)arg * ELEMENTS;
+  uint32_t data = 0;
+
+  for (uint32_t i = 0; i < ELEMENTS; i++)
+  {
+    data = base + i;
+    TEST_ASSERT_TRUE(stack_lf_push(stack, &data));
+    TEST_ASSERT_TRUE(stack_lf_pop(stack, &data));
+    __atomic_fetch_add(&seen[data], 1, __ATOMIC_RELAXED);
+  }
+
+  return NULL;
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  stack = stack_lf_create(sizeof(uint32_t));
+}
+
+void tearDown(void)
+{
+  stack_lf_delete(&stack);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Stack Lock-free Tests");
+}
+
+/**
+ * @brief Tests the order of elements in the single thread.
+ */
+void test_TestCase_0(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[STACK_TEST]: lock-free order");
+
+  TEST_ASSERT_NOT_NULL(stack);
+  TEST_ASSERT_TRUE(stack_lf_empty(stack));
+  TEST_ASSERT_FALSE(stack_lf_pop(stack, &data));
+  TEST_ASSERT_FALSE(stack_lf_peek(stack, &data));
+
+  for (uint32_t i = 0; i < 1000; i++)
+  {
+    TEST_ASSERT_TRUE(stack_lf_push(stack, &i));
+  }
+
+  TEST_ASSERT_TRUE(stack_lf_peek(stack, &data));
+  TEST_ASSERT_EQUAL_UINT32(999, data);
+
+  for (uint32_t i = 1000; i > 0; i--)
+  {
+    TEST_ASSERT_TRUE(stack_lf_pop(stack, &data));
+    TEST_ASSERT_EQUAL_UINT32(i - 1, data);
+  }
+  TEST_ASSERT_TRUE(stack_lf_empty(stack));
+  TEST_ASSERT_FALSE(stack_lf_pop(stack, &data));
+}
+
+/**
+ * @brief Tests that every element pushed by concurrent threads is popped once by concurrent threads.
+ */
+void test_TestCase_1(void)
+{
+  pthread_t threads[2 * THREADS];
+
+  TEST_MESSAGE("[STACK_TEST]: lock-free pushers and poppers");
+
+  memset(seen, 0, sizeof(seen));
+  for (uint32_t i = 0; i < THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, pusher, (void*)(uintptr_t)i));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[THREADS + i], NULL, popper, NULL));
+  }
+
+  for (uint32_t i = 0; i < 2 * THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+  }
+
+  for (size_t i = 0; i < THREADS * ELEMENTS; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(1, seen[i]);
+  }
+  TEST_ASSERT_TRUE(stack_lf_empty(stack));
+}
+
+/**
+ * @brief Tests the contended pairs of push and pop, which are completed by the elimination as well.
+ */
+void test_TestCase_2(void)
+{
+  pthread_t threads[THREADS];
+
+  TEST_MESSAGE("[STACK_TEST]: lock-free elimination");
+
+  memset(seen, 0, sizeof(seen));
+  for (uint32_t i = 0; i < THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, mixer, (void*)(uintptr_t)i));
+  }
+
+  for (uint32_t i = 0; i < THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+  }
+
+  for (size_t i = 0; i < THREADS * ELEMENTS; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(1, seen[i]);
+  }
+  TEST_ASSERT_TRUE(stack_lf_empty(stack));
+}
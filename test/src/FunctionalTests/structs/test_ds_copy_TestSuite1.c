@@ -0,0 +1,129 @@
+/**
+ * @file    test_ds_copy_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for element copy kernels.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_copy.h"
+#include "structs/queue/queue.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_BUFFER_SIZE (DS_COPY_STREAM_THRESHOLD + 64)
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static uint8_t* src = NULL;
+static uint8_t* dst = NULL;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+/**
+ * @brief Copies `esize` bytes by the selected kernel and checks that only they were changed.
+ */
+static void check_copy(size_t esize, size_t offset)
+{
+  memset(dst, 0xEE, TEST_BUFFER_SIZE);
+
+  ds_copy_fn_t copy = ds_copy_select(esize);
+  TEST_ASSERT_NOT_NULL(copy);
+  copy(dst + offset, src + offset, esize);
+
+  TEST_ASSERT_EQUAL_MEMORY(src + offset, dst + offset, esize);
+  for (size_t i = 0; i < offset; i++)
+  {
+    TEST_ASSERT_EQUAL_HEX8(0xEE, dst[i]);
+  }
+  TEST_ASSERT_EQUAL_HEX8(0xEE, dst[offset + esize]);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  src = (uint8_t*)malloc(TEST_BUFFER_SIZE);
+  dst = (uint8_t*)malloc(TEST_BUFFER_SIZE);
+
+  for (size_t i = 0; i < TEST_BUFFER_SIZE; i++)
+  {
+    src[i] = (uint8_t)(i * 31 + 7);
+  }
+}
+
+void tearDown(void)
+{
+  free(src);
+  free(dst);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Copy Kernels Tests");
+}
+
+/**
+ * @brief Tests the kernels for fixed, SIMD and generic sizes at aligned and unaligned addresses.
+ */
+void test_TestCase_0(void)
+{
+  static const size_t sizes[] = {1, 2, 3, 4, 7, 8, 16, 24, 32, 64, 96, 100, 256, 1024, 2048};
+
+  TEST_MESSAGE("[COPY_TEST]: kernels");
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    check_copy(sizes[i], 0);
+    check_copy(sizes[i], 5);
+  }
+}
+
+/**
+ * @brief Tests the non-temporal copy of the huge element.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[COPY_TEST]: huge element");
+
+  check_copy(DS_COPY_STREAM_THRESHOLD, 0);
+  check_copy(DS_COPY_STREAM_THRESHOLD + 13, 3);
+}
+
+/**
+ * @brief Tests the data structures with the element which is copied by the SIMD kernel.
+ */
+void test_TestCase_2(void)
+{
+  uint8_t element[96];
+  uint8_t output[96];
+
+  TEST_MESSAGE("[COPY_TEST]: data structures");
+
+  stack_t* stack = stack_create(0, sizeof(element));
+  queue_t* queue = queue_create(0, sizeof(element));
+  ring_buffer_t* rb = rb_create(4, sizeof(element));
+
+  memcpy(element, src, sizeof(element));
+  TEST_ASSERT_TRUE(stack_push(stack, element));
+  TEST_ASSERT_TRUE(queue_add(queue, element));
+  TEST_ASSERT_TRUE(rb_add(rb, element));
+
+  TEST_ASSERT_TRUE(stack_pop(stack, output));
+  TEST_ASSERT_EQUAL_MEMORY(element, output, sizeof(element));
+  TEST_ASSERT_TRUE(queue_get(queue, output));
+  TEST_ASSERT_EQUAL_MEMORY(element, output, sizeof(element));
+  TEST_ASSERT_TRUE(rb_get(rb, output));
+  TEST_ASSERT_EQUAL_MEMORY(element, output, sizeof(element));
+
+  stack_delete(&stack);
+  queue_delete(&queue);
+  rb_delete(&rb);
+}
@@ -0,0 +1,147 @@
+/**
+ * @file    test_ds_cursor_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for cursor over data structures.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_cursor.h"
+#include "structs/queue/queue.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define TEST_DS_LEN 16
+//_____ D E F I N I T I O N S _________________________________________________
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Cursor Tests");
+}
+
+/**
+ * @brief Tests that the cursor walks the queue from the head to the tail.
+ */
+void test_TestCase_0(void)
+{
+  ds_cursor_t cursor;
+  uint32_t* element = NULL;
+  uint32_t expected = 0;
+
+  TEST_MESSAGE("[CURSOR_TEST]: queue");
+
+  queue_t* queue = queue_create(0, sizeof(uint32_t));
+
+  ds_cursor_init(&cursor, queue);
+  TEST_ASSERT_NULL(ds_cursor_next(&cursor));
+
+  for (uint32_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    queue_add(queue, &i);
+  }
+
+  ds_cursor_init(&cursor, queue);
+  while (NULL != (element = (uint32_t*)ds_cursor_next(&cursor)))
+  {
+    TEST_ASSERT_EQUAL_UINT32(expected++, *element);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(TEST_DS_LEN, expected);
+
+  queue_delete(&queue);
+}
+
+/**
+ * @brief Tests that the cursor returns all elements of the stack from the bottom to the top as a single span.
+ */
+void test_TestCase_1(void)
+{
+  ds_cursor_t cursor;
+  ds_span_t span;
+
+  TEST_MESSAGE("[CURSOR_TEST]: stack");
+
+  stack_t* stack = stack_create(0, sizeof(uint32_t));
+
+  for (uint32_t i = 0; i < TEST_DS_LEN; i++)
+  {
+    stack_push(stack, &i);
+  }
+
+  ds_cursor_init(&cursor, stack);
+  TEST_ASSERT_EQUAL_UINT32(0, *(uint32_t*)ds_cursor_next(&cursor));
+  TEST_ASSERT_TRUE(ds_cursor_next_span(&cursor, &span));
+  TEST_ASSERT_EQUAL_UINT32(TEST_DS_LEN - 1, span.count);
+
+  for (uint32_t i = 0; i < span.count; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(i + 1, ((uint32_t*)span.data)[i]);
+  }
+
+  TEST_ASSERT_FALSE(ds_cursor_next_span(&cursor, &span));
+  TEST_ASSERT_NULL(ds_cursor_next(&cursor));
+
+  stack_delete(&stack);
+}
+
+/**
+ * @brief Tests that the cursor walks the wrapped ring buffer from the oldest element to the newest one.
+ */
+void test_TestCase_2(void)
+{
+  ds_cursor_t cursor;
+  uint32_t* element = NULL;
+  uint32_t data = 0;
+  uint32_t expected = TEST_DS_LEN / 2;
+  size_t visited = 0;
+
+  TEST_MESSAGE("[CURSOR_TEST]: ring buffer");
+
+  ring_buffer_t* rb = rb_create(TEST_DS_LEN, sizeof(uint32_t));
+
+  for (uint32_t i = 0; i < TEST_DS_LEN - 1; i++)
+  {
+    rb_add(rb, &i);
+  }
+
+  for (uint32_t i = 0; i < TEST_DS_LEN / 2; i++)
+  {
+    rb_get(rb, &data);
+  }
+
+  for (uint32_t i = TEST_DS_LEN - 1; i < TEST_DS_LEN - 1 + TEST_DS_LEN / 2; i++)
+  {
+    TEST_ASSERT_TRUE(rb_add(rb, &i));
+  }
+
+  ds_cursor_init(&cursor, rb);
+  while (NULL != (element = (uint32_t*)ds_cursor_next(&cursor)))
+  {
+    TEST_ASSERT_EQUAL_UINT32(expected++, *element);
+    visited++;
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(rb_size(rb), visited);
+
+  rb_delete(&rb);
+}
@@ -0,0 +1,208 @@
+/**
+ * @file    test_ds_fc_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for flat combining access to data structures.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_fc.h"
+#include "structs/queue/queue.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define THREADS  4
+#define ELEMENTS 20000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t producer;
+  uint32_t seq;
+} message_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ds_fc_t* fc = NULL;
+static uint8_t seen[THREADS * ELEMENTS];
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void* mixer(void* arg)
+{
+  message_t message = {.producer = (uint32_t)(uintptr_t)arg, .seq = 0};
+
+  for (uint32_t i = 0; i < ELEMENTS; i++)
+  {
+    message.producer = (uint32_t)(uintptr_t)arg;
+    message.seq = i;
+    TEST_ASSERT_TRUE(ds_fc_put(fc, &message));
+    TEST_ASSERT_TRUE(ds_fc_take(fc, &message));
+    __atomic_fetch_add(&seen[message.producer * ELEMENTS + message.seq], 1, __ATOMIC_RELAXED);
+  }
+
+  return NULL;
+}
+
+static void* producer(void* arg)
+{
+  message_t message = {.producer = (uint32_t)(uintptr_t)arg, .seq = 0};
+
+  for (uint32_t i = 0; i < ELEMENTS; i++)
+  {
+    message.seq = i;
+    TEST_ASSERT_TRUE(ds_fc_put(fc, &message));
+  }
+
+  return NULL;
+}
+
+static void* consumer(void* arg)
+{
+  int64_t last[THREADS] = {-1, -1, -1, -1};
+  message_t message = {0};
+
+  (void)arg;
+  for (size_t taken = 0; taken < ELEMENTS;)
+  {
+    if (ds_fc_take(fc, &message))
+    {
+      // Every consumer sees the elements of one producer in the order of adding
+      TEST_ASSERT_TRUE(message.producer < THREADS);
+      TEST_ASSERT_TRUE((int64_t)message.seq > last[message.producer]);
+      last[message.producer] = message.seq;
+      __atomic_fetch_add(&seen[message.producer * ELEMENTS + message.seq], 1, __ATOMIC_RELAXED);
+      taken++;
+    }
+  }
+
+  return NULL;
+}
+
+static void check_seen(void)
+{
+  for (size_t i = 0; i < THREADS * ELEMENTS; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(1, seen[i]);
+  }
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  memset(seen, 0, sizeof(seen));
+}
+
+void tearDown(void)
+{
+  if (NULL != fc)
+  {
+    ds_fc_delete(&fc);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Flat Combining Tests");
+}
+
+/**
+ * @brief Tests the order of elements of the wrapped stack and queue in the single thread.
+ */
+void test_TestCase_0(void)
+{
+  message_t message = {0};
+
+  TEST_MESSAGE("[FC_TEST]: order");
+
+  TEST_ASSERT_NULL(ds_fc_create(NULL));
+
+  fc = ds_fc_create(stack_create(0, sizeof(message_t)));
+  TEST_ASSERT_NOT_NULL(fc);
+  TEST_ASSERT_NOT_NULL(ds_fc_ds(fc));
+  TEST_ASSERT_FALSE(ds_fc_take(fc, &message));
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    message.seq = i;
+    TEST_ASSERT_TRUE(ds_fc_put(fc, &message));
+  }
+  for (uint32_t i = 10; i > 0; i--)
+  {
+    TEST_ASSERT_TRUE(ds_fc_take(fc, &message));
+    TEST_ASSERT_EQUAL_UINT32(i - 1, message.seq);
+  }
+  ds_fc_delete(&fc);
+  TEST_ASSERT_NULL(fc);
+
+  fc = ds_fc_create(queue_create(3, sizeof(message_t)));
+  TEST_ASSERT_NOT_NULL(fc);
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    message.seq = i;
+    TEST_ASSERT_TRUE(ds_fc_put(fc, &message));
+  }
+  TEST_ASSERT_FALSE(ds_fc_put(fc, &message));
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_TRUE(ds_fc_take(fc, &message));
+    TEST_ASSERT_EQUAL_UINT32(i, message.seq);
+  }
+  TEST_ASSERT_FALSE(ds_fc_take(fc, &message));
+  TEST_ASSERT_EQUAL_UINT32(0, ds_fc_eliminated(fc));
+}
+
+/**
+ * @brief Tests the contended pairs of push and pop on the stack, which are completed by the elimination as well.
+ */
+void test_TestCase_1(void)
+{
+  pthread_t threads[THREADS];
+
+  TEST_MESSAGE("[FC_TEST]: stack threads");
+
+  fc = ds_fc_create(stack_create(0, sizeof(message_t)));
+  TEST_ASSERT_NOT_NULL(fc);
+
+  for (uint32_t i = 0; i < THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, mixer, (void*)(uintptr_t)i));
+  }
+  for (uint32_t i = 0; i < THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+  }
+
+  check_seen();
+  TEST_ASSERT_TRUE(stack_empty(ds_fc_ds(fc)));
+}
+
+/**
+ * @brief Tests that every element of concurrent producers is retrieved once from the queue by concurrent consumers.
+ */
+void test_TestCase_2(void)
+{
+  pthread_t threads[2 * THREADS];
+
+  TEST_MESSAGE("[FC_TEST]: queue threads");
+
+  fc = ds_fc_create(queue_create(0, sizeof(message_t)));
+  TEST_ASSERT_NOT_NULL(fc);
+
+  for (uint32_t i = 0; i < THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, producer, (void*)(uintptr_t)i));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[THREADS + i], NULL, consumer, NULL));
+  }
+  for (uint32_t i = 0; i < 2 * THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+  }
+
+  check_seen();
+  TEST_ASSERT_TRUE(queue_empty(ds_fc_ds(fc)));
+}
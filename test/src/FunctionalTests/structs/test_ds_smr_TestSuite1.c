@@ -0,0 +1,273 @@
+/**
+ * @file    test_ds_smr_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for safe memory reclamation.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_smr.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define READERS 3
+#define WRITERS 2
+#define UPDATES 20000
+#define MAGIC   0x5AFEC0DEU
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint32_t magic;
+  uint32_t value;
+} node_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static ds_smr_t* smr = NULL;
+static _Atomic(void*) shared = NULL;
+static atomic_size_t allocated = 0;
+static atomic_size_t reclaimed = 0;
+static atomic_bool stop = false;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static node_t* node_create(uint32_t value)
+{
+  node_t* node = (node_t*)malloc(sizeof(node_t));
+  TEST_ASSERT_NOT_NULL(node);
+
+  node->magic = MAGIC;
+  node->value = value;
+  atomic_fetch_add(&allocated, 1);
+
+  return node;
+}
+
+static void reclaim(void* ctx, void* node)
+{
+  TEST_ASSERT_EQUAL_PTR(&reclaimed, ctx);
+
+  ((node_t*)node)->magic = 0;
+  free(node);
+  atomic_fetch_add((atomic_size_t*)ctx, 1);
+}
+
+static void* reader(void* arg)
+{
+  ds_smr_thread_t* thread = ds_smr_register(smr);
+  TEST_ASSERT_NOT_NULL(thread);
+
+  (void)arg;
+  while (!atomic_load(&stop))
+  {
+    ds_smr_enter(thread);
+    node_t* node = (node_t*)ds_smr_protect(thread, 0, &shared);
+    TEST_ASSERT_EQUAL_HEX32(MAGIC, node->magic);
+    ds_smr_leave(thread);
+  }
+
+  ds_smr_unregister(&thread);
+  TEST_ASSERT_NULL(thread);
+
+  return NULL;
+}
+
+static void* writer(void* arg)
+{
+  ds_smr_thread_t* thread = ds_smr_register(smr);
+  TEST_ASSERT_NOT_NULL(thread);
+
+  for (uint32_t i = 0; i < UPDATES; i++)
+  {
+    node_t* node = node_create((uint32_t)(uintptr_t)arg * UPDATES + i);
+    void* old = atomic_exchange(&shared, node);
+    TEST_ASSERT_TRUE(ds_smr_retire(thread, old));
+  }
+
+  ds_smr_unregister(&thread);
+
+  return NULL;
+}
+
+static void run_threads(ds_smr_kind_t kind)
+{
+  pthread_t readers[READERS];
+  pthread_t writers[WRITERS];
+
+  smr = ds_smr_create(kind, reclaim, &reclaimed);
+  TEST_ASSERT_NOT_NULL(smr);
+  atomic_store(&shared, node_create(0));
+  atomic_store(&stop, false);
+
+  for (size_t i = 0; i < READERS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&readers[i], NULL, reader, NULL));
+  }
+  for (size_t i = 0; i < WRITERS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&writers[i], NULL, writer, (void*)(uintptr_t)i));
+  }
+
+  for (size_t i = 0; i < WRITERS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(writers[i], NULL));
+  }
+  atomic_store(&stop, true);
+  for (size_t i = 0; i < READERS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(readers[i], NULL));
+  }
+
+  ds_smr_delete(&smr);
+  free(atomic_load(&shared));
+  TEST_ASSERT_EQUAL_UINT32(atomic_load(&allocated) - 1, atomic_load(&reclaimed));
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  atomic_store(&allocated, 0);
+  atomic_store(&reclaimed, 0);
+}
+
+void tearDown(void)
+{
+  if (NULL != smr)
+  {
+    ds_smr_delete(&smr);
+  }
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Safe Memory Reclamation Tests");
+}
+
+/**
+ * @brief Tests that the node protected by the hazard pointer is reclaimed only after it is released.
+ */
+void test_TestCase_0(void)
+{
+  TEST_MESSAGE("[SMR_TEST]: hazard pointers");
+
+  smr = ds_smr_create(DS_SMR_HAZARD, reclaim, &reclaimed);
+  TEST_ASSERT_NOT_NULL(smr);
+
+  ds_smr_thread_t* owner = ds_smr_register(smr);
+  ds_smr_thread_t* other = ds_smr_register(smr);
+  TEST_ASSERT_NOT_NULL(owner);
+  TEST_ASSERT_NOT_NULL(other);
+
+  atomic_store(&shared, node_create(1));
+  node_t* node = (node_t*)ds_smr_protect(other, 1, &shared);
+  TEST_ASSERT_EQUAL_UINT32(1, node->value);
+
+  atomic_store(&shared, NULL);
+  TEST_ASSERT_TRUE(ds_smr_retire(owner, node));
+  TEST_ASSERT_EQUAL_UINT32(0, ds_smr_flush(owner));
+  TEST_ASSERT_EQUAL_UINT32(1, ds_smr_pending(owner));
+  TEST_ASSERT_EQUAL_HEX32(MAGIC, node->magic);
+
+  ds_smr_leave(other);
+  TEST_ASSERT_EQUAL_UINT32(1, ds_smr_flush(owner));
+  TEST_ASSERT_EQUAL_UINT32(0, ds_smr_pending(owner));
+  TEST_ASSERT_EQUAL_UINT32(1, atomic_load(&reclaimed));
+
+  ds_smr_unregister(&owner);
+  ds_smr_unregister(&other);
+}
+
+/**
+ * @brief Tests that the node retired while another thread is inside the section outlives the section.
+ */
+void test_TestCase_1(void)
+{
+  TEST_MESSAGE("[SMR_TEST]: epochs");
+
+  smr = ds_smr_create(DS_SMR_EPOCH, reclaim, &reclaimed);
+  TEST_ASSERT_NOT_NULL(smr);
+
+  ds_smr_thread_t* owner = ds_smr_register(smr);
+  ds_smr_thread_t* other = ds_smr_register(smr);
+  TEST_ASSERT_NOT_NULL(owner);
+  TEST_ASSERT_NOT_NULL(other);
+
+  ds_smr_enter(other);
+  TEST_ASSERT_TRUE(ds_smr_retire(owner, node_create(2)));
+  for (size_t i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(0, ds_smr_flush(owner));
+  }
+
+  ds_smr_leave(other);
+  size_t count = 0;
+  for (size_t i = 0; i < 4; i++)
+  {
+    count += ds_smr_flush(owner);
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, count);
+
+  ds_smr_unregister(&owner);
+  ds_smr_unregister(&other);
+}
+
+/**
+ * @brief Tests that the record of the unregistered thread is reused with its retired nodes and that the nodes
+ *        left at the end are reclaimed by the deletion of the domain.
+ */
+void test_TestCase_2(void)
+{
+  TEST_MESSAGE("[SMR_TEST]: records");
+
+  smr = ds_smr_create(DS_SMR_EPOCH, reclaim, &reclaimed);
+  TEST_ASSERT_NOT_NULL(smr);
+
+  ds_smr_thread_t* owner = ds_smr_register(smr);
+  ds_smr_thread_t* other = ds_smr_register(smr);
+  ds_smr_thread_t* released = owner;
+
+  ds_smr_enter(other);
+  for (uint32_t i = 0; i < 3 * DS_SMR_BATCH; i++)
+  {
+    TEST_ASSERT_TRUE(ds_smr_retire(owner, node_create(i)));
+  }
+  ds_smr_unregister(&owner);
+
+  owner = ds_smr_register(smr);
+  TEST_ASSERT_EQUAL_PTR(released, owner);
+  TEST_ASSERT_EQUAL_UINT32(3 * DS_SMR_BATCH, ds_smr_pending(owner));
+
+  ds_smr_unregister(&owner);
+  ds_smr_leave(other);
+  ds_smr_unregister(&other);
+
+  ds_smr_delete(&smr);
+  TEST_ASSERT_NULL(smr);
+  TEST_ASSERT_EQUAL_UINT32(3 * DS_SMR_BATCH, atomic_load(&reclaimed));
+}
+
+/**
+ * @brief Tests the readers of the shared node which is replaced concurrently, protected by hazard pointers.
+ */
+void test_TestCase_3(void)
+{
+  TEST_MESSAGE("[SMR_TEST]: hazard pointers threads");
+
+  run_threads(DS_SMR_HAZARD);
+}
+
+/**
+ * @brief Tests the readers of the shared node which is replaced concurrently, protected by epochs.
+ */
+void test_TestCase_4(void)
+{
+  TEST_MESSAGE("[SMR_TEST]: epochs threads");
+
+  run_threads(DS_SMR_EPOCH);
+}
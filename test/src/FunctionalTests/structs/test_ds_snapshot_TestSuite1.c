@@ -0,0 +1,314 @@
+/**
+ * @file    test_ds_snapshot_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for snapshots of data structures.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_cursor.h"
+#include "structs/ds_snapshot.h"
+#include "structs/queue/queue.h"
+#include "structs/queue/queue_mpsc.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define BUFFER_SIZE (256U * 1024U)
+#define ELEMENTS 5000
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  uint8_t* data;
+  size_t size;
+  size_t offset;
+  size_t calls;
+} buffer_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+static buffer_t buffer;
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static bool buffer_write(void* ctx, const void* data, size_t size)
+{
+  buffer_t* b = (buffer_t*)ctx;
+
+  if (b->offset + size > b->size)
+  {
+    return false;
+  }
+
+  memcpy(b->data + b->offset, data, size);
+  b->offset += size;
+  b->calls++;
+
+  return true;
+}
+
+static bool buffer_read(void* ctx, void* data, size_t size)
+{
+  buffer_t* b = (buffer_t*)ctx;
+
+  if (b->offset + size > b->size)
+  {
+    return false;
+  }
+
+  memcpy(data, b->data + b->offset, size);
+  b->offset += size;
+
+  return true;
+}
+
+/**
+ * @brief Saves the data structure into the buffer and restores it.
+ */
+static ds_t* round_trip(const ds_t* ds)
+{
+  ds_writer_t writer = {.write = buffer_write, .ctx = &buffer};
+  ds_reader_t reader = {.read = buffer_read, .ctx = &buffer};
+
+  buffer.offset = 0;
+  buffer.calls = 0;
+  buffer.size = BUFFER_SIZE;
+  TEST_ASSERT_TRUE(ds_snapshot(ds, &writer));
+  TEST_ASSERT_EQUAL_UINT32(ds_snapshot_size(ds), buffer.offset);
+
+  buffer.size = buffer.offset;
+  buffer.offset = 0;
+
+  return ds_restore(&reader);
+}
+
+/**
+ * @brief Checks that both data structures contain the same elements in the same order.
+ */
+static void check_equal(const ds_t* expected, const ds_t* actual)
+{
+  ds_cursor_t a;
+  ds_cursor_t b;
+  void* element;
+
+  TEST_ASSERT_NOT_NULL(actual);
+  TEST_ASSERT_EQUAL_INT(expected->iface->kind, actual->iface->kind);
+  TEST_ASSERT_EQUAL_UINT32(expected->iface->capacity(expected), actual->iface->capacity(actual));
+
+  size_t esize = expected->iface->esize(expected);
+  ds_cursor_init(&a, expected);
+  ds_cursor_init(&b, actual);
+
+  while (NULL != (element = ds_cursor_next(&a)))
+  {
+    void* other = ds_cursor_next(&b);
+    TEST_ASSERT_NOT_NULL(other);
+    TEST_ASSERT_EQUAL_MEMORY(element, other, esize);
+  }
+  TEST_ASSERT_NULL(ds_cursor_next(&b));
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+  buffer.data = (uint8_t*)malloc(BUFFER_SIZE);
+  buffer.size = BUFFER_SIZE;
+  buffer.offset = 0;
+}
+
+void tearDown(void)
+{
+  free(buffer.data);
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Snapshot Tests");
+}
+
+/**
+ * @brief Tests the snapshots of the stack, the queue and the wrapped ring buffer.
+ */
+void test_TestCase_0(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[SNAPSHOT_TEST]: round trip");
+
+  stack_t* stack = stack_create(0, sizeof(uint32_t));
+  queue_t* queue = queue_create(ELEMENTS, sizeof(uint32_t));
+  ring_buffer_t* rb = rb_create(ELEMENTS, sizeof(uint32_t));
+
+  for (uint32_t i = 0; i < ELEMENTS - 1; i++)
+  {
+    TEST_ASSERT_TRUE(stack_push(stack, &i));
+    TEST_ASSERT_TRUE(queue_add(queue, &i));
+    TEST_ASSERT_TRUE(rb_add(rb, &i));
+  }
+  for (uint32_t i = 0; i < ELEMENTS / 2; i++)
+  {
+    TEST_ASSERT_TRUE(rb_get(rb, &data));
+    TEST_ASSERT_TRUE(rb_add(rb, &i));
+  }
+
+  ds_t* restored = round_trip(stack);
+  check_equal(stack, restored);
+  TEST_ASSERT_TRUE(stack_pop(restored, &data));
+  TEST_ASSERT_EQUAL_UINT32(ELEMENTS - 2, data);
+  stack_delete(&restored);
+
+  restored = round_trip(queue);
+  check_equal(queue, restored);
+  // Elements of the list are gathered into chunks
+  TEST_ASSERT_TRUE(buffer.calls < ELEMENTS / 100);
+  queue_delete(&restored);
+
+  restored = round_trip(rb);
+  check_equal(rb, restored);
+  TEST_ASSERT_TRUE(rb_is_full(restored));
+  rb_delete(&restored);
+
+  stack_delete(&stack);
+  queue_delete(&queue);
+  rb_delete(&rb);
+}
+
+/**
+ * @brief Tests the streams which produce and consume the snapshot by small pieces.
+ */
+void test_TestCase_1(void)
+{
+  uint8_t piece[7];
+  uint8_t element[24];
+
+  TEST_MESSAGE("[SNAPSHOT_TEST]: streams");
+
+  queue_t* queue = queue_create(0, sizeof(element));
+  for (uint32_t i = 0; i < 300; i++)
+  {
+    memset(element, (int)i, sizeof(element));
+    TEST_ASSERT_TRUE(queue_add(queue, element));
+  }
+
+  ds_snapshot_stream_t* out = ds_snapshot_begin(queue);
+  ds_restore_stream_t* in = ds_restore_begin();
+  TEST_ASSERT_NOT_NULL(out);
+  TEST_ASSERT_NOT_NULL(in);
+
+  size_t total = 0;
+  size_t n;
+  for (size_t i = 0; 0 != (n = ds_snapshot_next(out, piece, 1 + i % sizeof(piece))); i++)
+  {
+    TEST_ASSERT_TRUE(ds_restore_feed(in, piece, n));
+    total += n;
+  }
+  ds_snapshot_end(&out);
+  TEST_ASSERT_NULL(out);
+  TEST_ASSERT_EQUAL_UINT32(ds_snapshot_size(queue), total);
+
+  ds_t* restored = ds_restore_end(&in);
+  TEST_ASSERT_NULL(in);
+  check_equal(queue, restored);
+  queue_delete(&restored);
+
+  // The incomplete snapshot isn't restored
+  out = ds_snapshot_begin(queue);
+  in = ds_restore_begin();
+  n = ds_snapshot_next(out, buffer.data, 100);
+  TEST_ASSERT_EQUAL_UINT32(100, n);
+  TEST_ASSERT_TRUE(ds_restore_feed(in, buffer.data, n));
+  TEST_ASSERT_NULL(ds_restore_end(&in));
+  ds_snapshot_end(&out);
+
+  queue_delete(&queue);
+}
+
+/**
+ * @brief Tests the rejection of the corrupted snapshots.
+ */
+void test_TestCase_2(void)
+{
+  ds_writer_t writer = {.write = buffer_write, .ctx = &buffer};
+  ds_reader_t reader = {.read = buffer_read, .ctx = &buffer};
+  uint16_t data = 0xABCD;
+
+  TEST_MESSAGE("[SNAPSHOT_TEST]: corrupted");
+
+  ring_buffer_t* rb = rb_create(8, sizeof(data));
+  TEST_ASSERT_TRUE(rb_add(rb, &data));
+  TEST_ASSERT_TRUE(ds_snapshot(rb, &writer));
+  size_t size = buffer.offset;
+  TEST_ASSERT_EQUAL_UINT32(DS_SNAPSHOT_HEADER_SIZE + sizeof(data), size);
+
+  // Truncated
+  buffer.size = size - 1;
+  buffer.offset = 0;
+  TEST_ASSERT_NULL(ds_restore(&reader));
+
+  // Extra data
+  ds_restore_stream_t* in = ds_restore_begin();
+  TEST_ASSERT_TRUE(ds_restore_feed(in, buffer.data, size));
+  TEST_ASSERT_FALSE(ds_restore_feed(in, buffer.data, 1));
+  TEST_ASSERT_NULL(ds_restore_end(&in));
+
+  // Wrong count
+  buffer.data[24] = 8;
+  buffer.size = size;
+  buffer.offset = 0;
+  TEST_ASSERT_NULL(ds_restore(&reader));
+  buffer.data[24] = 1;
+
+  // Wrong magic
+  buffer.data[0] ^= 0xFF;
+  buffer.offset = 0;
+  TEST_ASSERT_NULL(ds_restore(&reader));
+  buffer.data[0] ^= 0xFF;
+
+  buffer.offset = 0;
+  ds_t* restored = ds_restore(&reader);
+  TEST_ASSERT_NOT_NULL(restored);
+  check_equal(rb, restored);
+
+  // The writer which fails
+  buffer.size = 10;
+  buffer.offset = 0;
+  TEST_ASSERT_FALSE(ds_snapshot(rb, &writer));
+
+  rb_delete(&restored);
+  rb_delete(&rb);
+}
+
+/**
+ * @brief Tests that the snapshot of MPSC queue is restored into the ordinary queue.
+ */
+void test_TestCase_3(void)
+{
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[SNAPSHOT_TEST]: MPSC queue");
+
+  queue_mpsc_t* mpsc = queue_mpsc_create(sizeof(uint32_t));
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(queue_mpsc_add(mpsc, &i));
+  }
+
+  ds_t* restored = round_trip(mpsc);
+  TEST_ASSERT_NOT_NULL(restored);
+  TEST_ASSERT_EQUAL_INT(DS_KIND_QUEUE, restored->iface->kind);
+  TEST_ASSERT_EQUAL_UINT32(10, queue_size(restored));
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(queue_get(restored, &data));
+    TEST_ASSERT_EQUAL_UINT32(i, data);
+  }
+
+  queue_delete(&restored);
+  queue_mpsc_delete(&mpsc);
+}
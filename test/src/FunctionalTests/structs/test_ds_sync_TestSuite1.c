@@ -0,0 +1,261 @@
+/**
+ * @file    test_ds_sync_TestSuite1.c
+ * @author  Aleksander Kovalchuk (aliaksander.kavalchuk@gmail.com)
+ * @brief   Set of unit tests for synchronized access to data structures.
+ * @date    2026-10-18
+ */
+//_____ I N C L U D E S _______________________________________________________
+#include "unity.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "core/container.h"
+#include "core/linked_list/linked_list.h"
+#include "core/vector/vector.h"
+#include "interface/allocator_if.h"
+#include "structs/ds_sync.h"
+#include "structs/queue/queue.h"
+#include "structs/rb/ring_buffer.h"
+#include "structs/stack/stack.h"
+
+//_____ C O N F I G S  ________________________________________________________
+#define THREADS 4
+#define ELEMENTS 20000
+#define BATCH 16
+#define TEST_SHM_NAME "/uds_test_ds_sync"
+//_____ D E F I N I T I O N S _________________________________________________
+typedef struct
+{
+  ds_sync_t* sync;
+  uint32_t id;
+  uint64_t sum;
+  size_t count;
+} worker_t;
+//_____ M A C R O S ___________________________________________________________
+//_____ V A R I A B L E S _____________________________________________________
+//_____ P R I V A T E  F U N C T I O N S_______________________________________
+static void* producer(void* arg)
+{
+  worker_t* w = (worker_t*)arg;
+  uint32_t batch[BATCH];
+
+  for (uint32_t i = 0; i < ELEMENTS; i += BATCH)
+  {
+    for (uint32_t j = 0; j < BATCH; j++)
+    {
+      batch[j] = w->id * ELEMENTS + i + j;
+    }
+
+    size_t n = 0;
+    while (n < BATCH)
+    {
+      n += ds_sync_put_batch(w->sync, batch + n, BATCH - n);
+    }
+  }
+
+  return NULL;
+}
+
+static void* consumer(void* arg)
+{
+  worker_t* w = (worker_t*)arg;
+  uint32_t data = 0;
+
+  while (w->count < ELEMENTS)
+  {
+    if (ds_sync_take(w->sync, &data))
+    {
+      w->sum += data;
+      w->count++;
+    }
+  }
+
+  return NULL;
+}
+
+static void* reader(void* arg)
+{
+  worker_t* w = (worker_t*)arg;
+  uint32_t data = 0;
+
+  for (size_t i = 0; i < ELEMENTS; i++)
+  {
+    TEST_ASSERT_TRUE(ds_sync_size(w->sync) <= THREADS * ELEMENTS);
+    if (ds_sync_peek(w->sync, &data))
+    {
+      w->count++;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Runs the producers and the consumers and checks that every element was taken once.
+ */
+static void check_threads(ds_t* ds, ds_lock_t lock)
+{
+  pthread_t threads[2 * THREADS + 1];
+  worker_t workers[2 * THREADS + 1];
+
+  ds_sync_t* sync = ds_sync_create(ds, lock);
+  TEST_ASSERT_NOT_NULL(sync);
+  TEST_ASSERT_EQUAL_PTR(ds, ds_sync_ds(sync));
+
+  memset(workers, 0, sizeof(workers));
+  for (uint32_t i = 0; i < 2 * THREADS + 1; i++)
+  {
+    workers[i].sync = sync;
+    workers[i].id = i;
+  }
+
+  for (uint32_t i = 0; i < THREADS; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, producer, &workers[i]));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[THREADS + i], NULL, consumer, &workers[THREADS + i]));
+  }
+  TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[2 * THREADS], NULL, reader, &workers[2 * THREADS]));
+
+  for (uint32_t i = 0; i < 2 * THREADS + 1; i++)
+  {
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+  }
+
+  uint64_t expected = (uint64_t)THREADS * ELEMENTS * (THREADS * ELEMENTS - 1) / 2;
+  uint64_t sum = 0;
+  for (uint32_t i = THREADS; i < 2 * THREADS; i++)
+  {
+    sum += workers[i].sum;
+  }
+
+  TEST_ASSERT_TRUE(expected == sum);
+  TEST_ASSERT_EQUAL_UINT32(0, ds_sync_size(sync));
+
+  ds_sync_delete(&sync);
+  TEST_ASSERT_NULL(sync);
+}
+//_____ P U B L I C  F U N C T I O N S_________________________________________
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+  TEST_MESSAGE("Synchronized Access Tests");
+}
+
+/**
+ * @brief Tests all data structures with all kinds of locks from several threads.
+ */
+void test_TestCase_0(void)
+{
+  const ds_lock_t locks[] = {DS_LOCK_MUTEX, DS_LOCK_TICKET, DS_LOCK_RWLOCK};
+
+  TEST_MESSAGE("[SYNC_TEST]: threads");
+
+  for (size_t i = 0; i < sizeof(locks) / sizeof(locks[0]); i++)
+  {
+    check_threads(stack_create(0, sizeof(uint32_t)), locks[i]);
+    check_threads(queue_create(1000, sizeof(uint32_t)), locks[i]);
+    check_threads(rb_create(1000, sizeof(uint32_t)), locks[i]);
+  }
+}
+
+/**
+ * @brief Tests the batches and the sequence of operations under one acquisition of the lock.
+ */
+void test_TestCase_1(void)
+{
+  uint32_t input[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  uint32_t output[10] = {0};
+  uint32_t data = 0;
+
+  TEST_MESSAGE("[SYNC_TEST]: batches");
+
+  ds_sync_t* sync = ds_sync_create(rb_create(8, sizeof(uint32_t)), DS_LOCK_TICKET);
+  TEST_ASSERT_NOT_NULL(sync);
+
+  TEST_ASSERT_EQUAL_UINT32(7, ds_sync_put_batch(sync, input, 10));
+  TEST_ASSERT_FALSE(ds_sync_put(sync, &input[7]));
+  TEST_ASSERT_TRUE(ds_sync_peek(sync, &data));
+  TEST_ASSERT_EQUAL_UINT32(1, data);
+  TEST_ASSERT_EQUAL_UINT32(7, ds_sync_take_batch(sync, output, 10));
+  TEST_ASSERT_EQUAL_MEMORY(input, output, 7 * sizeof(uint32_t));
+  TEST_ASSERT_EQUAL_UINT32(0, ds_sync_take_batch(sync, output, 10));
+  ds_sync_delete(&sync);
+
+  sync = ds_sync_create(stack_create(0, sizeof(uint32_t)), DS_LOCK_MUTEX);
+  TEST_ASSERT_EQUAL_UINT32(10, ds_sync_put_batch(sync, input, 10));
+  TEST_ASSERT_EQUAL_UINT32(10, ds_sync_take_batch(sync, output, 10));
+  TEST_ASSERT_EQUAL_UINT32(10, output[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, output[9]);
+
+  ds_sync_lock(sync);
+  stack_t* stack = ds_sync_ds(sync);
+  TEST_ASSERT_TRUE(stack_push(stack, &input[0]));
+  TEST_ASSERT_TRUE(stack_push(stack, &input[1]));
+  ds_sync_unlock(sync);
+  TEST_ASSERT_EQUAL_UINT32(2, ds_sync_size(sync));
+  ds_sync_delete(&sync);
+
+  TEST_ASSERT_NULL(ds_sync_create(NULL, DS_LOCK_MUTEX));
+}
+
+/**
+ * @brief Tests the batch of elements put into the ring buffer with several producers.
+ */
+void test_TestCase_2(void)
+{
+  uint32_t input[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  uint32_t output[10] = {0};
+
+  TEST_MESSAGE("[SYNC_TEST]: batches of MPSC ring buffer");
+
+  rb_unlink_shared(TEST_SHM_NAME);
+  ring_buffer_t* rb = rb_create_shared(TEST_SHM_NAME, 8, sizeof(uint32_t), RB_SHARED_MPSC);
+  TEST_ASSERT_NOT_NULL(rb);
+  TEST_ASSERT_TRUE(rb_is_multi_producer(rb));
+
+  ds_sync_t* sync = ds_sync_create(rb, DS_LOCK_MUTEX);
+  TEST_ASSERT_NOT_NULL(sync);
+  TEST_ASSERT_EQUAL_UINT32(7, ds_sync_put_batch(sync, input, 10));
+  TEST_ASSERT_EQUAL_UINT32(7, ds_sync_take_batch(sync, output, 10));
+  TEST_ASSERT_EQUAL_MEMORY(input, output, 7 * sizeof(uint32_t));
+
+  ds_sync_delete(&sync);
+  TEST_ASSERT_TRUE(rb_unlink_shared(TEST_SHM_NAME));
+}
+
+/**
+ * @brief Tests that the wrappers and the queues don't share cache lines with the neighbouring allocations.
+ */
+void test_TestCase_3(void)
+{
+  ds_sync_t* sync[4] = {NULL};
+
+  TEST_MESSAGE("[SYNC_TEST]: cache line alignment");
+
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    sync[i] = ds_sync_create(queue_create(0, sizeof(uint32_t)), DS_LOCK_TICKET);
+    TEST_ASSERT_NOT_NULL(sync[i]);
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)sync[i] % DS_SYNC_CACHE_LINE);
+    TEST_ASSERT_EQUAL_UINT32(0, (uintptr_t)ds_sync_ds(sync[i]) % QUEUE_CACHE_LINE);
+    TEST_ASSERT_TRUE(ds_sync_put(sync[i], &i));
+  }
+
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    uint32_t item = 0;
+    TEST_ASSERT_TRUE(ds_sync_take(sync[i], &item));
+    TEST_ASSERT_EQUAL_UINT32(i, item);
+    ds_sync_delete(&sync[i]);
+  }
+}